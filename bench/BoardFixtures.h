@@ -0,0 +1,133 @@
+#ifndef BOARD_FIXTURES_H
+#define BOARD_FIXTURES_H
+
+#include "Board.h"
+#include "GameCore.h"
+#include <cstdint>
+#include <vector>
+
+// Fixed, reproducible boards shared by the benchmarks. They are built
+// cell by cell from constant patterns and a private PRNG, so they do not
+// change when the game rules or the piece generator change.
+namespace fixtures {
+
+enum BoardFixture {
+    EMPTY = 0,   // Nothing placed
+    FLAT,        // Four solid rows with a well in the right column
+    RAGGED,      // Uneven surface up to 12 rows high, with holes
+    TALL,        // Stack reaching 4 rows from the top
+    FIXTURE_COUNT
+};
+
+inline const char* fixtureName(int fixture) {
+    static const char* names[] = {"empty", "flat", "ragged", "tall"};
+    return names[fixture];
+}
+
+inline uint32_t nextRandom(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+inline Board makeBoard(int fixture) {
+    Board board;
+    uint32_t state = 0x12345678u + static_cast<uint32_t>(fixture);
+
+    int height = 0;
+    switch (fixture) {
+        case FLAT: height = 4; break;
+        case RAGGED: height = 12; break;
+        case TALL: height = Board::HEIGHT - 4; break;
+        default: break;
+    }
+
+    for (int x = 0; x < Board::WIDTH; x++) {
+        int columnHeight = height;
+        if (fixture == RAGGED) {
+            columnHeight = 2 + static_cast<int>(nextRandom(state) % (height - 1));
+        }
+        if (fixture != RAGGED && x == Board::WIDTH - 1) {
+            columnHeight = 0;  // Well
+        }
+
+        for (int y = Board::HEIGHT - columnHeight; y < Board::HEIGHT; y++) {
+            // Roughly one hole in eight below the surface on the ragged board
+            bool hole = fixture == RAGGED && y > Board::HEIGHT - columnHeight &&
+                        nextRandom(state) % 8 == 0;
+            if (!hole) {
+                board.setCell(x, y, static_cast<int>(nextRandom(state) % 7));
+            }
+        }
+    }
+    return board;
+}
+
+// Board with the given number of full rows interleaved with partial ones
+template <typename BoardType = Board>
+inline BoardType makeClearBoard(int fullRows) {
+    BoardType board;
+    for (int i = 0; i < 8; i++) {
+        int y = BoardType::HEIGHT - 1 - i;
+        bool full = (i % 2 == 0) && (i / 2) < fullRows;
+        for (int x = 0; x < BoardType::WIDTH; x++) {
+            if (full || x != i) {
+                board.setCell(x, y, (x + i) % 7);
+            }
+        }
+    }
+    return board;
+}
+
+// Every placement of every piece that fits on the board
+inline std::vector<Tetromino> fittingPieces(const Board& board) {
+    std::vector<Tetromino> pieces;
+    for (int type = 0; type < 7; type++) {
+        for (int rotation = 0; rotation < 4; rotation++) {
+            for (int y = -1; y < Board::HEIGHT; y++) {
+                for (int x = -3; x < Board::WIDTH; x++) {
+                    Tetromino piece(static_cast<TetrominoType>(type), x, y);
+                    for (int i = 0; i < rotation; i++) {
+                        piece.rotate();
+                    }
+                    if (board.canPlace(piece)) {
+                        pieces.push_back(piece);
+                    }
+                }
+            }
+        }
+    }
+    return pieces;
+}
+
+// A mix of fitting and colliding pieces in a fixed order
+inline std::vector<Tetromino> probePieces(int count) {
+    std::vector<Tetromino> pieces;
+    uint32_t state = 0xC0FFEEu;
+    for (int i = 0; i < count; i++) {
+        TetrominoType type = static_cast<TetrominoType>(nextRandom(state) % 7);
+        int x = static_cast<int>(nextRandom(state) % Board::WIDTH) - 1;
+        int y = static_cast<int>(nextRandom(state) % Board::HEIGHT);
+        Tetromino piece(type, x, y);
+        for (uint32_t r = nextRandom(state) % 4; r > 0; r--) {
+            piece.rotate();
+        }
+        pieces.push_back(piece);
+    }
+    return pieces;
+}
+
+// Fresh game whose current piece has been soft-dropped the given number of rows
+inline GameCore makeCoreAtHeight(int rows) {
+    GameCore core(42);
+    core.reset();
+    for (int i = 0; i < rows; i++) {
+        core.applyAction(InputAction::SOFT_DROP);
+    }
+    return core;
+}
+
+}
+
+#endif
@@ -0,0 +1,217 @@
+#include "BoardFeatures.h"
+#include "BoardFixtures.h"
+#include "PlacementEnumerator.h"
+#include "VecEnv.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Heap allocations made anywhere in the process, so benchmarks of code that
+// must not allocate can check it
+static std::atomic<uint64_t> allocations(0);
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+using namespace fixtures;
+
+static void BM_BoardCanPlace(benchmark::State& state) {
+    const Board board = makeBoard(static_cast<int>(state.range(0)));
+    const std::vector<Tetromino> pieces = probePieces(1024);
+    state.SetLabel(fixtureName(static_cast<int>(state.range(0))));
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(board.canPlace(pieces[i]));
+        i = (i + 1) & 1023;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BoardCanPlace)->DenseRange(EMPTY, FIXTURE_COUNT - 1);
+
+// Includes copying the fixture so every iteration starts from the same board
+static void BM_BoardPlace(benchmark::State& state) {
+    const Board fixture = makeBoard(static_cast<int>(state.range(0)));
+    const std::vector<Tetromino> pieces = fittingPieces(fixture);
+    state.SetLabel(fixtureName(static_cast<int>(state.range(0))));
+
+    size_t i = 0;
+    for (auto _ : state) {
+        Board board = fixture;
+        board.place(pieces[i]);
+        benchmark::DoNotOptimize(board);
+        i = (i + 1) % pieces.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BoardPlace)->DenseRange(EMPTY, FIXTURE_COUNT - 1);
+
+// Includes copying the fixture so every iteration has rows to clear
+static void BM_BoardClearLines(benchmark::State& state) {
+    const Board fixture = makeClearBoard<>(static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        Board board = fixture;
+        benchmark::DoNotOptimize(board.clearLines());
+        benchmark::DoNotOptimize(board);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BoardClearLines)->DenseRange(0, 4);
+
+// Drop a piece and clear two lines on each instantiated board size
+template <typename BoardType>
+static void BM_BoardSizeDropAndClear(benchmark::State& state) {
+    const BoardType fixture = makeClearBoard<BoardType>(2);
+    const Tetromino piece(O, BoardType::WIDTH / 2, 0);
+
+    for (auto _ : state) {
+        BoardType board = fixture;
+        Tetromino dropped = piece;
+        dropped.setPosition(piece.getX(), board.getLandingY(piece));
+        board.place(dropped);
+        benchmark::DoNotOptimize(board.clearLines());
+        benchmark::DoNotOptimize(board);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_BoardSizeDropAndClear, Board);
+BENCHMARK_TEMPLATE(BM_BoardSizeDropAndClear, TallBoard);
+BENCHMARK_TEMPLATE(BM_BoardSizeDropAndClear, WideBoard);
+BENCHMARK_TEMPLATE(BM_BoardSizeDropAndClear, GiantBoard);
+
+static void BM_TetrominoGetOccupiedCells(benchmark::State& state) {
+    const std::vector<Tetromino> pieces = probePieces(1024);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        auto cells = pieces[i].getOccupiedCells();
+        benchmark::DoNotOptimize(cells);
+        i = (i + 1) & 1023;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TetrominoGetOccupiedCells);
+
+static void BM_GameUpdateGhostPiece(benchmark::State& state) {
+    GameCore core = makeCoreAtHeight(static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        core.updateGhostPiece();
+        benchmark::DoNotOptimize(core.getGhostPiece());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GameUpdateGhostPiece)->Arg(0)->Arg(5)->Arg(10)->Arg(15);
+
+// Includes copying the game so every iteration drops from the same height,
+// and locking the piece and spawning the next
+static void BM_GameHardDrop(benchmark::State& state) {
+    const GameCore fixture = makeCoreAtHeight(static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        GameCore core = fixture;
+        core.applyAction(InputAction::HARD_DROP);
+        benchmark::DoNotOptimize(core.getCurrentPiece());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GameHardDrop)->Arg(0)->Arg(5)->Arg(10)->Arg(15);
+
+// One full move generation: all seven piece types per iteration
+static void BM_EnumeratePlacements(benchmark::State& state) {
+    const Board board = makeBoard(static_cast<int>(state.range(0)));
+    const bool softDrop = state.range(1) != 0;
+    PlacementEnumerator enumerator;
+    state.SetLabel(std::string(fixtureName(static_cast<int>(state.range(0)))) +
+                   (softDrop ? " +tucks" : " hard drop"));
+
+    for (auto _ : state) {
+        for (int type = 0; type < 7; type++) {
+            Tetromino piece(static_cast<TetrominoType>(type));
+            benchmark::DoNotOptimize(enumerator.enumerate(board, piece, softDrop));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 7);
+}
+BENCHMARK(BM_EnumeratePlacements)->ArgsProduct({{EMPTY, FIXTURE_COUNT - 1}, {0, 1}});
+
+static void BM_ExtractFeatures(benchmark::State& state) {
+    const Board board = makeBoard(static_cast<int>(state.range(0)));
+    state.SetLabel(fixtureName(static_cast<int>(state.range(0))));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(extractFeatures(board));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ExtractFeatures)->DenseRange(EMPTY, FIXTURE_COUNT - 1);
+
+// Contiguous boards through the SIMD batch kernel (items = boards)
+static void BM_ExtractFeaturesBatch(benchmark::State& state) {
+    std::vector<Board> boards;
+    for (int i = 0; i < 1024; i++) {
+        boards.push_back(makeBoard(i % FIXTURE_COUNT));
+    }
+    std::vector<BoardFeatures> features(boards.size());
+
+    for (auto _ : state) {
+        extractFeatures(boards.data(), boards.size(), features.data());
+        benchmark::DoNotOptimize(features.data());
+    }
+    state.SetItemsProcessed(state.iterations() * boards.size());
+}
+BENCHMARK(BM_ExtractFeaturesBatch);
+
+// Rollback round trip: capture the state, then restore it
+static void BM_GameSnapshotRestore(benchmark::State& state) {
+    GameCore core = makeCoreAtHeight(static_cast<int>(state.range(0)));
+    GameSnapshot snapshot;
+
+    for (auto _ : state) {
+        core.snapshot(snapshot);
+        benchmark::DoNotOptimize(snapshot);
+        core.restore(snapshot);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(std::to_string(sizeof(GameSnapshot)) + " bytes");
+}
+BENCHMARK(BM_GameSnapshotRestore)->Arg(0)->Arg(15);
+
+// Lockstep environment step on 1 or 4 threads (items = game steps). Stepping
+// must not allocate; the run fails if it did
+static void BM_VecEnvStep(benchmark::State& state) {
+    VecEnvConfig config;
+    config.envs = static_cast<int>(state.range(0));
+    config.threads = static_cast<int>(state.range(1));
+    VecEnv env(config);
+
+    std::vector<uint8_t> actions(config.envs);
+    for (int i = 0; i < config.envs; i++) {
+        actions[i] = static_cast<uint8_t>(i % VecEnv::ACTION_COUNT);
+    }
+
+    uint64_t before = allocations.load();
+    for (auto _ : state) {
+        env.step(actions.data());
+        benchmark::DoNotOptimize(env.getObservations());
+    }
+    uint64_t allocated = allocations.load() - before;
+    state.counters["allocs"] = static_cast<double>(allocated);
+    if (allocated > 0) state.SkipWithError("VecEnv::step allocated");
+    state.SetItemsProcessed(state.iterations() * config.envs);
+}
+BENCHMARK(BM_VecEnvStep)->ArgsProduct({{64, 1024}, {1, 4}})->UseRealTime();
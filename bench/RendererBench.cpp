@@ -0,0 +1,12 @@
+#include "Renderer.h"
+#include <benchmark/benchmark.h>
+
+static void BM_RendererFormatNumber(benchmark::State& state) {
+    const int number = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Renderer::formatNumber(number));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RendererFormatNumber)->Arg(0)->Arg(999)->Arg(123456)->Arg(2147483647);
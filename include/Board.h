@@ -1,44 +1,178 @@
 #ifndef BOARD_H
 #define BOARD_H
 
-#include <vector>
+#include <array>
+#include <cstdint>
+#include <type_traits>
 #include "Tetromino.h"
 
-class Board {
+// Narrowest unsigned integer holding one bit per column
+template <int W>
+using BoardRow = std::conditional_t<(W <= 16), uint16_t,
+                                    std::conditional_t<(W <= 32), uint32_t, uint64_t>>;
+
+// Playfield of W columns by H visible rows, with BUFFER hidden rows above
+// where pieces spawn. The dimensions are compile-time constants, so every
+// size gets its own fully unrolled collision and line clear code; the
+// sizes in use are instantiated in Board.cpp. Row indices count from the
+// top of the buffer, so the visible field is rows BUFFER_ROWS to HEIGHT - 1
+template <int W, int H, int BUFFER>
+class BasicBoard {
+public:
+    static constexpr int WIDTH = W;
+    static constexpr int HEIGHT = H + BUFFER;  // Stored rows, buffer included
+    static constexpr int VISIBLE_HEIGHT = H;
+    static constexpr int BUFFER_ROWS = BUFFER;
+
+    static_assert(W >= 4 && W <= 64, "Board width must be 4-64 columns");
+    static_assert(H >= 4 && BUFFER >= 2 && H + BUFFER <= 127,
+                  "Board needs 4+ visible rows, 2+ buffer rows and at most 127 rows");
+
+    using Row = BoardRow<W>;
+
+private:
+    static constexpr Row fullRow() {
+        Row mask = 0;
+        for (int x = 0; x < W; x++) mask |= static_cast<Row>(Row(1) << x);
+        return mask;
+    }
+
+public:
+    // Occupancy mask of a completely filled row
+    static constexpr Row FULL_ROW = fullRow();
+
+    // Row indices (top to bottom, before compaction) of completed lines
+    struct ClearedRows {
+        int count = 0;
+        int rows[HEIGHT];
+    };
+
+    // Complete board state as plain bytes (snapshot/restore is a copy)
+    struct Snapshot {
+        std::array<Row, HEIGHT> rows;
+        std::array<int8_t, WIDTH * HEIGHT> colors;
+        std::array<int8_t, WIDTH> columnTops;
+        int8_t stackTop;
+        uint64_t hash;
+    };
+
+    // Read-only view over the color plane, indexed as grid[row][col]
+    class GridView {
+    public:
+        class Row {
+        public:
+            explicit Row(const int8_t* cells) : cells(cells) {}
+            int operator[](int col) const { return cells[col]; }
+
+        private:
+            const int8_t* cells;
+        };
+
+        explicit GridView(const int8_t* colors) : colors(colors) {}
+        Row operator[](int row) const { return Row(colors + row * WIDTH); }
+        int size() const { return HEIGHT; }
+
+    private:
+        const int8_t* colors;
+    };
+
 private:
-    static const int WIDTH = 10;
-    static const int HEIGHT = 20;
-    
-    // Game board: -1 = empty, 0-6 = tetromino type
-    std::vector<std::vector<int>> grid;
-    
+    // Occupancy bitboard: one mask per row, bit x set = column x filled
+    std::array<Row, HEIGHT> rows;
+
+    // Color plane (only needed for rendering): -1 = empty, 0-6 = tetromino type
+    std::array<int8_t, WIDTH * HEIGHT> colors;
+
+    // Surface profile: row of the highest filled cell per column (HEIGHT = empty)
+    std::array<int8_t, WIDTH> columnTops;
+
+    // Highest filled row (HEIGHT = empty board); nothing above it needs scanning
+    int stackTop;
+
+    // Zobrist hash of the occupied cells, updated as cells are filled
+    uint64_t hash;
+
+    // Collision test of a piece shape at a position
+    bool fits(const PieceMask& mask, int x, int y) const;
+
+    // Rebuild columnTops and stackTop from the row masks
+    void updateColumnTops();
+
+    // Combined cell keys of the filled cells of a row mask placed at row y
+    static uint64_t rowHash(int y, Row mask);
+
 public:
-    Board();
-    
+    BasicBoard();
+
     // Check if piece can be placed at position
     bool canPlace(const Tetromino& piece) const;
-    
+
     // Place piece on board (finalize it)
     void place(const Tetromino& piece);
-    
+
+    // Row the piece would come to rest on if dropped straight down
+    int getLandingY(const Tetromino& piece) const;
+
     // Clear completed lines and return count
     int clearLines();
-    
-    // Check if board is full (game over)
-    bool isGameOver() const;
-    
+
+    // Clear completed lines, recording which rows they were
+    int clearLines(ClearedRows& cleared);
+
+    // Find completed lines without clearing them
+    int findFullRows(ClearedRows& full) const;
+    bool hasFullRow() const;
+
+    // Stack has grown into the hidden buffer (search treats this as lost)
+    bool isGameOver() const { return stackTop < BUFFER_ROWS; }
+
     // Get cell value
     int getCell(int x, int y) const;
-    
+
+    void snapshot(Snapshot& out) const;
+    void restore(const Snapshot& in);
+
+    // Set cell value directly (-1 clears it); used for fixtures and garbage rows
+    void setCell(int x, int y, int value);
+
     // Reset board
     void clear();
-    
+
     // Get dimensions
     int getWidth() const { return WIDTH; }
     int getHeight() const { return HEIGHT; }
-    
-    // Get board for rendering
-    const std::vector<std::vector<int>>& getGrid() const { return grid; }
+
+    // Get occupancy mask of a row
+    Row getRow(int y) const { return rows[y]; }
+
+    // Zobrist hash of the occupancy (colors are not included)
+    uint64_t getHash() const { return hash; }
+
+    // Number of rows from the floor to the top filled cell of a column
+    int getColumnHeight(int x) const { return HEIGHT - columnTops[x]; }
+
+    // Highest filled row (HEIGHT if the board is empty), and rows filled up to it
+    int getStackTop() const { return stackTop; }
+    int getStackHeight() const { return HEIGHT - stackTop; }
+
+    // Get board for rendering (cheap view, no copy)
+    GridView getGrid() const { return GridView(colors.data()); }
 };
 
+// Standard 10x20 field with a 4-row spawn buffer, used by the game rules,
+// search and rendering
+using Board = BasicBoard<10, 20, 4>;
+
+// Standard field with the full 20-row guideline buffer (10x40 in total)
+using TallBoard = BasicBoard<10, 20, 20>;
+
+// Party mode fields
+using WideBoard = BasicBoard<20, 20, 4>;
+using GiantBoard = BasicBoard<64, 32, 4>;
+
+extern template class BasicBoard<10, 20, 4>;
+extern template class BasicBoard<10, 20, 20>;
+extern template class BasicBoard<20, 20, 4>;
+extern template class BasicBoard<64, 32, 4>;
+
 #endif
@@ -0,0 +1,30 @@
+#ifndef BOARD_FEATURES_H
+#define BOARD_FEATURES_H
+
+#include "Board.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Surface and structure statistics used to score boards in AI search
+struct BoardFeatures {
+    std::array<int8_t, Board::WIDTH> columnHeights;
+    int aggregateHeight;    // Sum of the column heights
+    int bumpiness;          // Sum of height differences between neighbouring columns
+    int holes;              // Empty cells with a filled cell somewhere above
+    int rowTransitions;     // Filled/empty changes along each row (walls are filled)
+    int columnTransitions;  // Filled/empty changes down each column (floor is filled)
+    int wells;              // Open cells with both horizontal neighbours filled
+};
+
+// All features in one pass over the packed row masks. Rows above the
+// stack do not count towards row transitions
+BoardFeatures extractFeatures(const Board& board);
+
+// Features of count contiguous boards, several boards at a time: one board
+// per 16-bit SIMD lane (8 with SSE2, 16 with AVX2), scalar for the rest
+void extractFeatures(const Board* boards, size_t count, BoardFeatures* out);
+
+int countHoles(const Board& board);
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef FONT_H
+#define FONT_H
+
+#include <SDL2/SDL.h>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Built-in 5x5 bitmap font. Glyphs are rasterized once per scale into a
+// white atlas texture and drawn as batched quads tinted by vertex color;
+// fixed labels can be cached as whole prerendered textures
+class Font {
+public:
+    static constexpr int GLYPH_SIZE = 5;
+    static constexpr int GLYPH_ADVANCE = 6;  // Font pixels per character
+    static constexpr int MAX_SCALE = 8;
+
+    Font();
+    ~Font();
+    Font(const Font&) = delete;
+    Font& operator=(const Font&) = delete;
+
+    void init(SDL_Renderer* renderer);
+
+    // Queue text as glyph quads; submitted by flush()
+    void drawText(const std::string& text, int x, int y, SDL_Color color, int scale);
+
+    // Copy a fixed label from its own cached texture
+    void drawStaticText(const std::string& text, int x, int y, SDL_Color color, int scale);
+
+    void flush();
+
+    // Drop every texture; they are rebuilt on next use
+    void releaseTextures();
+
+    static int measureText(const std::string& text, int scale);
+
+    // Five row bitmaps for c, bit 4 is the leftmost column
+    static const uint8_t* getGlyph(char c);
+
+private:
+    SDL_Renderer* renderer;
+    std::array<SDL_Texture*, MAX_SCALE + 1> atlases;
+    std::unordered_map<std::string, SDL_Texture*> staticTexts;
+
+    // Glyph quads queued for the current batch, all from one atlas
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    int batchScale;
+
+    SDL_Texture* getAtlas(int scale);
+    SDL_Texture* createTexture(const std::vector<uint32_t>& pixels, int width, int height);
+};
+
+#endif
@@ -1,10 +1,13 @@
 #ifndef GAME_H
 #define GAME_H
 
-#include "Board.h"
-#include "Tetromino.h"
+#include "GameCore.h"
+#include "HeuristicPolicy.h"
+#include "InputHandler.h"
 #include "Renderer.h"
+#include "Replay.h"
 #include <memory>
+#include <vector>
 
 enum class GameState {
     TITLE,
@@ -14,34 +17,71 @@ enum class GameState {
     LINE_CLEAR_ANIM
 };
 
+// SDL front end: turns keyboard events into core input actions and
+// draws the core's state every frame
 class Game {
 private:
-    Board board;
-    Tetromino currentPiece;
-    Tetromino nextPiece;
-    Tetromino ghostPiece;
-    std::unique_ptr<Tetromino> holdPiece;
+    // Length of the line clear flash, in ticks
+    static constexpr int LINE_CLEAR_FRAMES = 20;
+
+    // Ticks simulated at most per loop iteration; time beyond that after a
+    // stall is dropped instead of fast-forwarding the game
+    static constexpr int MAX_CATCH_UP_TICKS = 8;
+
+    GameCore core;
     std::unique_ptr<Renderer> renderer;
 
-    int score;
     int highScore;
-    int level;
-    int lines;
-    int frameCounter;
-    bool gameOver;
     bool paused;
     bool running;
-    bool canHold;  // Can only hold once per piece
 
     // Game state
     GameState state;
 
-    // Game speed (frames until piece moves down)
-    int dropSpeed;
-
     // Animation
     int animFrameCounter;
 
+    // What the last rendered frame showed, to decide which layers to redraw
+    struct ViewState {
+        GameState state;
+        int pieceType, pieceX, pieceY, pieceRotation;
+        int piecesPlaced, lines, score, highScore;
+        int holdType;
+        bool canHold;
+        float dropOffset;
+    };
+    ViewState lastView;
+
+    // Gameplay keys (with DAS/ARR repeats) become timestamped actions, each
+    // applied between the ticks it happened between
+    Uint64 counterFrequency;
+    InputHandler input;
+    std::vector<TimedAction> dueActions;
+
+    // Every game is recorded and written to REPLAY_FILE when it ends
+    static constexpr const char* REPLAY_FILE = "last_replay.trp";
+    Replay replay;
+    bool recording;
+
+    // Render interpolation: rows the falling piece is drawn above its cell
+    // while it slides into the row gravity just moved it to
+    bool gravityStepped;
+    float dropOffset;
+
+    // Autoplay: the heuristic bot enters one input per tick and plans again
+    // for each new piece, or when gravity or a blocked input puts the piece
+    // somewhere its plan did not expect. botPlan holds the piece's full
+    // position after each input, so soft drops and tucks land on their row
+    std::unique_ptr<HeuristicPolicy> bot;
+    std::unique_ptr<TranspositionTable> botCache;
+    int botLookahead;
+    bool autoplay;
+    std::vector<InputAction> botActions;
+    std::vector<PieceState> botPlan;
+    size_t botStep;
+    PieceState botExpected;
+    int botPieces;
+
 public:
     Game();
 
@@ -52,32 +92,36 @@ public:
     void render();
     void run();
 
+    // Render as fast as possible instead of at the display refresh rate
+    void setUncapped(bool uncapped) { renderer->setVSync(!uncapped); }
+
+    // DAS, ARR and soft drop speed
+    void setInputConfig(const InputConfig& config) { input.setConfig(config); }
+
+    // Let the bot play (B toggles it in game); lookahead is set before it starts
+    void setAutoplay(bool enabled);
+    void setBotLookahead(int pieces) { botLookahead = pieces; }
+
     // Game state
-    bool isGameOver() const { return gameOver; }
+    bool isGameOver() const { return state == GameState::GAME_OVER; }
     bool isPaused() const { return paused; }
     bool isRunning() const { return running; }
 
-    int getScore() const { return score; }
+    int getScore() const { return core.getScore(); }
     int getHighScore() const { return highScore; }
-    int getLevel() const { return level; }
-    int getLines() const { return lines; }
-
-    // Tetromino methods
-    void spawnNewPiece();
-    bool movePieceDown();
-    bool movePieceLeft();
-    bool movePieceRight();
-    bool rotatePiece();
-    void holdCurrentPiece();
-    void updateGhostPiece();
+    int getLevel() const { return core.getLevel(); }
+    int getLines() const { return core.getLines(); }
 
 private:
-    void lockPiece();
-    void increaseLevel();
-    void updateDropSpeed();
     void saveHighScore();
     void loadHighScore();
+    void saveReplay();
     void resetGame();
+    void trackChanges();
+    void applyQueuedActions(Uint64 until);
+    void planBot();
+    void stepBot();
+    Uint64 eventTime(Uint32 timestamp) const;
 };
 
 #endif
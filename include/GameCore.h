@@ -0,0 +1,201 @@
+#ifndef GAME_CORE_H
+#define GAME_CORE_H
+
+#include "Board.h"
+#include "PieceGenerator.h"
+#include "Tetromino.h"
+#include <cstdint>
+#include <type_traits>
+
+// Abstract player inputs understood by the simulation core
+enum class InputAction : uint8_t {
+    MOVE_LEFT,
+    MOVE_RIGHT,
+    ROTATE,            // Clockwise
+    SOFT_DROP,
+    HARD_DROP,
+    HOLD,
+    SHIFT_LEFT_FULL,   // Slide as far left as possible (0 ms auto-repeat)
+    SHIFT_RIGHT_FULL,
+    ROTATE_CCW,
+    ROTATE_180
+};
+
+// Complete mutable state of a GameCore in a few hundred plain bytes, for
+// search and rollback. Snapshot and restore are straight copies with no
+// allocation. Settings (line clear and lock delays) are not included
+struct GameSnapshot {
+    Board::Snapshot board;
+    PieceGenerator generator;  // Includes the RNG state and preview queue
+    int32_t gravityRows;
+    int32_t score;
+    int32_t level;
+    int32_t lines;
+    int32_t piecesPlaced;
+    uint32_t tickCount;
+    PieceState currentPiece;
+    PieceState nextPiece;
+    PieceState ghostPiece;
+    PieceState holdPiece;
+    int16_t lineClearTimer;
+    int16_t lockTimer;
+    int16_t lockResets;
+    int8_t lowestRow;
+    int8_t clearedCount;
+    int8_t clearedRows[4];  // A piece spans at most four rows
+    bool hasHoldPiece;
+    bool canHold;
+    bool gameOver;
+};
+
+static_assert(std::is_trivially_copyable<GameSnapshot>::value,
+              "GameSnapshot must stay memcpy-able");
+
+// Headless game rules: board, pieces, gravity and scoring.
+// Advances only through applyAction() and tick(); never touches SDL,
+// so it can run without a window and as fast as the CPU allows.
+class GameCore {
+public:
+    // Fixed simulation rate; tick() always advances by 1 / TICK_RATE seconds
+    static constexpr int TICK_RATE = 60;
+
+    // Gravity is measured in rows per tick as 16.16 fixed point: 1G moves a
+    // piece one row every tick. 20G and above is instant, dropping the
+    // piece straight to its landing row
+    static constexpr int GRAVITY_SHIFT = 16;
+    static constexpr int32_t GRAVITY_ONE = 1 << GRAVITY_SHIFT;
+    static constexpr int32_t GRAVITY_20G = 20 * GRAVITY_ONE;
+
+    // New pieces enter centered, in the bottom two rows of the hidden buffer
+    static constexpr int SPAWN_X = (Board::WIDTH - 4) / 2;
+    static constexpr int SPAWN_Y = Board::BUFFER_ROWS - 2;
+
+    // A new piece of this type as it enters: at the spawn position, then
+    // straight down one row when there is room (the guideline drop on
+    // spawn), so it shows at the top of the visible field at once
+    static Tetromino spawnPiece(const Board& board, TetrominoType type);
+
+    // Guideline lock delay: half a second on the ground, restarted by up to
+    // 15 moves or rotations before the piece drops below its lowest row
+    static constexpr int DEFAULT_LOCK_DELAY = TICK_RATE / 2;
+    static constexpr int DEFAULT_LOCK_RESETS = 15;
+
+private:
+    Board board;
+    PieceGenerator generator;
+    Tetromino currentPiece;
+    Tetromino nextPiece;
+    Tetromino ghostPiece;  // Current piece at its landing row; gravity falls to it
+    Tetromino holdPiece;
+    bool hasHoldPiece;
+
+    int score;
+    int level;
+    int lines;
+    int piecesPlaced;
+    uint32_t tickCount;  // Ticks simulated since reset
+    bool gameOver;
+    bool canHold;  // Can only hold once per piece
+
+    // Gravity for the level, and the fraction of a row fallen since the
+    // piece last moved down (both rows per tick, fixed point)
+    int32_t gravity;
+    int32_t gravityRows;
+
+    // Ticks completed lines stay on the board before being removed
+    // (0 = remove immediately, as headless runs want)
+    int lineClearDelay;
+    int lineClearTimer;
+    Board::ClearedRows lastClear;
+
+    // Lock delay state machine, advanced once per tick. A falling piece has
+    // lockTimer 0; each tick it spends grounded counts up, and it locks on
+    // the tick the count passes lockDelay. A move or rotation of a grounded
+    // piece restarts the timer, but only maxLockResets times per lowest row
+    // reached; with no resets left a grounded piece locks at the next tick
+    int lockDelay;
+    int maxLockResets;
+    int lockTimer;
+    int lockResets;
+    int lowestRow;  // Deepest row the current piece has reached
+
+public:
+    explicit GameCore(uint64_t seed = 0, GeneratorMode mode = GeneratorMode::UNIFORM);
+
+    // Start a new game (replays the previous piece sequence)
+    void reset();
+
+    // Start a new game with a fresh piece sequence
+    void reset(uint64_t seed);
+
+    // Capture or roll back the whole game state
+    void snapshot(GameSnapshot& out) const;
+    void restore(const GameSnapshot& in);
+
+    // Apply a single player input to the current piece
+    void applyAction(InputAction action);
+
+    // Advance the simulation by the given number of fixed ticks
+    void tick(int ticks = 1);
+
+    // Game state
+    bool isGameOver() const { return gameOver; }
+    int getScore() const { return score; }
+    int getLevel() const { return level; }
+    int getLines() const { return lines; }
+    int getPiecesPlaced() const { return piecesPlaced; }
+    uint32_t getTickCount() const { return tickCount; }
+    int32_t getGravity() const { return gravity; }
+    bool canHoldPiece() const { return canHold; }
+
+    // Zobrist hash of the position for search: board, current and next
+    // piece types and the hold slot (not where the current piece is)
+    uint64_t getHash() const;
+
+    // Line clear delay (lets the front end animate completed rows)
+    void setLineClearDelay(int ticks) { lineClearDelay = ticks; }
+    int getLineClearDelay() const { return lineClearDelay; }
+    bool isClearingLines() const { return lineClearTimer > 0; }
+    const Board::ClearedRows& getLastClear() const { return lastClear; }
+
+    // Lock delay in ticks (0 = lock on the first tick grounded), and moves
+    // or rotations that may restart it before the piece reaches a new row
+    void setLockDelay(int ticks) { lockDelay = ticks; }
+    int getLockDelay() const { return lockDelay; }
+    void setMaxLockResets(int resets) { maxLockResets = resets; }
+    int getMaxLockResets() const { return maxLockResets; }
+    int getLockTimer() const { return lockTimer; }
+
+    const Board& getBoard() const { return board; }
+    const Tetromino& getCurrentPiece() const { return currentPiece; }
+    const Tetromino& getNextPiece() const { return nextPiece; }
+    const Tetromino& getGhostPiece() const { return ghostPiece; }
+    const Tetromino* getHoldPiece() const { return hasHoldPiece ? &holdPiece : nullptr; }
+    const PieceGenerator& getGenerator() const { return generator; }
+    PieceGenerator& getGenerator() { return generator; }
+
+    // Tetromino methods (moving the piece directly needs updateGhostPiece()
+    // before the next tick, since gravity falls to the ghost)
+    void spawnNewPiece();
+    bool movePieceDown();
+    void hardDropPiece();  // Drops and locks
+    bool movePieceLeft();
+    bool movePieceRight();
+    int shiftPieceFully(int direction);  // Returns the number of columns moved
+    bool rotatePiece(int turns = 1);  // Quarter turns clockwise (3 = counter-clockwise)
+    void holdCurrentPiece();
+    void updateGhostPiece();
+
+private:
+    bool isGrounded() const;
+    void resetLockState();
+    void trackLowestRow();
+    void restartLockDelay();
+    void lockPiece();
+    void finishLock();
+    void increaseLevel();
+    void updateGravity();
+    void applyGravity();
+};
+
+#endif
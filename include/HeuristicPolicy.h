@@ -0,0 +1,75 @@
+#ifndef HEURISTIC_POLICY_H
+#define HEURISTIC_POLICY_H
+
+#include "BoardFeatures.h"
+#include "MovePolicy.h"
+#include "PlacementEnumerator.h"
+#include "ThreadPool.h"
+#include "TranspositionTable.h"
+#include <array>
+#include <memory>
+#include <vector>
+
+// Feature weights of the board evaluation (higher score = better board)
+struct HeuristicWeights {
+    double lines = 0.760666;
+    double aggregateHeight = -0.510066;
+    double holes = -0.35663;
+    double bumpiness = -0.184483;
+};
+
+// Plays the current piece (or the hold alternative) where the best board
+// comes out after also placing 1-2 more pieces. Only pieces the player can
+// see are searched: the next piece, the held piece (playable by holding
+// later), and the piece holding into an empty slot reveals; the queue
+// behind the preview stays hidden, so lookahead 2 needs something in hold
+// (or the hold alternative) to reach the second piece. Root placements
+// include tucks and spins; lookahead pieces are hard dropped. With more than
+// one thread the lookahead under each root placement runs as its own task
+class HeuristicPolicy : public MovePolicy {
+public:
+    static constexpr int MAX_LOOKAHEAD = 2;
+
+    // threads: 1 searches on the calling thread, 0 = one per hardware thread
+    explicit HeuristicPolicy(int lookahead = 1, int threads = 1,
+                             const HeuristicWeights& weights = HeuristicWeights());
+
+    void chooseActions(const GameCore& core, std::vector<InputAction>& actions) override;
+
+    int getLookahead() const { return lookahead; }
+
+    // Cache lookahead results in a (possibly shared) table. Policies may
+    // only share a table when they use the same weights
+    void setTranspositionTable(TranspositionTable* cache) { table = cache; }
+
+private:
+    int lookahead;
+    HeuristicWeights weights;
+    std::unique_ptr<ThreadPool> pool;
+    TranspositionTable* table;
+
+    // Root alternatives: play the current piece, or hold and play another
+    struct Option {
+        PlacementEnumerator enumerator;
+        std::array<TetrominoType, MAX_LOOKAHEAD> upcoming;
+        bool hold;
+    };
+    int searchDepth;  // Lookahead this move, limited to the visible pieces
+    std::array<Option, 2> options;
+    std::vector<double> scores;  // Per root placement, option 0's first
+    std::array<InputAction, PlacementEnumerator::MAX_PATH> path;
+
+    // Board terms only; lines cleared are added by whoever placed the piece
+    double evaluate(const Board& board) const;
+    double score(const BoardFeatures& features) const;
+
+    // Best score reachable by hard dropping the next depth upcoming pieces
+    // onto board. Depends only on its arguments, so it can be cached
+    double search(const Board& board, const TetrominoType* upcoming, int depth) const;
+
+    // Lock piece at placement and search on from the resulting board
+    double scoreRoot(const Board& board, const Option& option, const Tetromino& piece,
+                     const Placement& placement) const;
+};
+
+#endif
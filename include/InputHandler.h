@@ -0,0 +1,77 @@
+#ifndef INPUT_HANDLER_H
+#define INPUT_HANDLER_H
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <vector>
+#include "GameCore.h"
+
+// Auto-repeat tuning, in milliseconds
+struct InputConfig {
+    int das = 167;            // Delayed auto shift: hold time before repeating
+    int arr = 33;             // Auto repeat rate; 0 = shift straight to the wall
+    int softDropFactor = 20;  // Soft drop falls this many times faster than gravity (at most 1G)
+};
+
+// A core action stamped with the performance-counter time it happened at
+struct TimedAction {
+    Uint64 time;
+    InputAction action;
+};
+
+// Turns timestamped key events into core actions, running DAS/ARR and soft
+// drop repeat in-engine instead of relying on OS key repeat. Key state is
+// tracked by scancode and checked against SDL_GetKeyboardState so a missed
+// key-up (focus loss) cannot leave a direction stuck
+class InputHandler {
+public:
+    explicit InputHandler(Uint64 counterFrequency, const InputConfig& config = InputConfig());
+
+    void setConfig(const InputConfig& newConfig) { config = newConfig; }
+    const InputConfig& getConfig() const { return config; }
+
+    // Record a gameplay key event; returns false for keys it does not handle
+    bool handleEvent(const SDL_Event& event, Uint64 time);
+
+    // Release held keys the keyboard state no longer reports as down
+    void syncKeyboardState(Uint64 now);
+
+    // Append, in time order, every action due up to `until`; gravity is the
+    // core's, in fixed-point rows per tick
+    void collect(Uint64 until, int32_t gravity, std::vector<TimedAction>& out);
+
+    // Forget all keys and pending events (pause, new game)
+    void reset();
+
+private:
+    enum Key : uint8_t {
+        KEY_LEFT, KEY_RIGHT, KEY_SOFT_DROP, KEY_ROTATE, KEY_HARD_DROP, KEY_HOLD,
+        KEY_ROTATE_CCW, KEY_ROTATE_180, KEY_COUNT
+    };
+
+    struct KeyEvent {
+        Uint64 time;
+        Key key;
+        bool down;
+    };
+
+    InputConfig config;
+    Uint64 countsPerSecond;
+
+    std::vector<KeyEvent> events;
+    bool held[KEY_COUNT];
+
+    // Horizontal auto-shift: the most recently pressed direction wins
+    int shiftDirection;  // -1, 0 or 1
+    Uint64 nextShift;
+    Uint64 nextSoftDrop;
+
+    static int keyFor(SDL_Scancode scancode);
+    Uint64 millisToCounts(int ms) const;
+    void applyEvent(const KeyEvent& event, int32_t gravity, std::vector<TimedAction>& out);
+    void runRepeats(Uint64 until, int32_t gravity, std::vector<TimedAction>& out);
+    void startShift(int direction, Uint64 time);
+    Uint64 softDropPeriod(int32_t gravity) const;
+};
+
+#endif
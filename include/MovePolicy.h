@@ -0,0 +1,57 @@
+#ifndef MOVE_POLICY_H
+#define MOVE_POLICY_H
+
+#include "GameCore.h"
+#include "PlacementEnumerator.h"
+#include "TranspositionTable.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Decides how each new piece is played in headless simulation
+class MovePolicy {
+public:
+    virtual ~MovePolicy() = default;
+
+    // Fill actions with the inputs for the current piece (ending in a drop).
+    // The vector is reused between calls, so steady state never allocates.
+    virtual void chooseActions(const GameCore& core, std::vector<InputAction>& actions) = 0;
+
+    // Build a policy by name ("random", "greedy" or "heuristic"); nullptr
+    // if unknown. lookahead is the preview pieces the heuristic searches,
+    // cache an optional transposition table for it (may be shared)
+    static std::unique_ptr<MovePolicy> create(const std::string& name, uint64_t seed,
+                                              int lookahead = 1,
+                                              TranspositionTable* cache = nullptr);
+
+protected:
+    // Append rotate / shift / hard drop inputs that steer the current
+    // piece to the given rotation and column
+    static void appendPlacement(const GameCore& core, int rotation, int column,
+                                std::vector<InputAction>& actions);
+};
+
+// Drops each piece at a uniformly random rotation and column
+class RandomPolicy : public MovePolicy {
+private:
+    uint64_t state;
+
+public:
+    explicit RandomPolicy(uint64_t seed);
+    void chooseActions(const GameCore& core, std::vector<InputAction>& actions) override;
+};
+
+// Tries every hard-drop placement, keeping the one that clears the most
+// lines, then leaves the fewest holes, then lands lowest
+class GreedyPolicy : public MovePolicy {
+private:
+    PlacementEnumerator enumerator;
+    std::array<InputAction, PlacementEnumerator::MAX_PATH> path;
+
+public:
+    void chooseActions(const GameCore& core, std::vector<InputAction>& actions) override;
+};
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef PIECE_GENERATOR_H
+#define PIECE_GENERATOR_H
+
+#include "Tetromino.h"
+#include <array>
+#include <cstdint>
+
+enum class GeneratorMode : uint8_t {
+    UNIFORM,    // Every piece drawn independently (1 in 7)
+    SEVEN_BAG   // Each run of 7 pieces is a shuffled permutation of all types
+};
+
+// Per-game deterministic piece source. Uses xoshiro256** seeded through
+// splitmix64, so the same seed always yields the same sequence and games
+// on different threads never share state.
+class PieceGenerator {
+public:
+    static constexpr int MAX_PREVIEW = 16;
+
+private:
+    // Room for a full preview plus one refill batch
+    static constexpr int QUEUE_CAPACITY = 32;
+
+    uint64_t state[4];
+    uint64_t seed;
+    GeneratorMode mode;
+    int previewSize;
+
+    // Ring buffer of upcoming pieces
+    std::array<uint8_t, QUEUE_CAPACITY> queue;
+    int head;
+    int count;
+
+public:
+    explicit PieceGenerator(uint64_t seed = 0,
+                            GeneratorMode mode = GeneratorMode::UNIFORM,
+                            int previewSize = 5);
+
+    // Restart the sequence from a seed
+    void reset(uint64_t newSeed);
+
+    // Take the next piece from the queue
+    TetrominoType next();
+
+    // Look at an upcoming piece without consuming it (0 = next piece)
+    TetrominoType peek(int index) const;
+
+    void setMode(GeneratorMode newMode);
+    void setPreviewSize(int size);
+
+    GeneratorMode getMode() const { return mode; }
+    int getPreviewSize() const { return previewSize; }
+    uint64_t getSeed() const { return seed; }
+
+private:
+    uint64_t nextRandom();
+    uint32_t nextBounded(uint32_t bound);
+
+    // Append a batch of 7 pieces to the queue
+    void refill();
+};
+
+#endif
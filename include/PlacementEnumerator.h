@@ -0,0 +1,85 @@
+#ifndef PLACEMENT_ENUMERATOR_H
+#define PLACEMENT_ENUMERATOR_H
+
+#include "Board.h"
+#include "GameCore.h"
+#include "Tetromino.h"
+#include <array>
+#include <cstdint>
+
+// A resting position a piece can be steered into and locked at
+struct Placement {
+    int8_t x, y;
+    int8_t rotation;
+    bool tucked;   // Needs a soft drop before the last shift or rotation
+    int16_t node;  // Search node it was found at (for getPath)
+};
+
+// Lists every reachable final placement of a piece: each rotation, column
+// and landing row, plus (optionally) soft-drop tucks and spins. Breadth-first
+// search over (x, y, rotation) with the same moves, SRS kicks and canPlace()
+// rules as GameCore; placements covering the same cells are reported once.
+// All storage is fixed-size members, so enumerate() never allocates; keep
+// one enumerator per thread and reuse it.
+class PlacementEnumerator {
+public:
+    // Piece origins range over x in [-3, WIDTH) and y in [-3, HEIGHT)
+    static constexpr int NODE_COLUMNS = Board::WIDTH + 3;
+    static constexpr int NODE_ROWS = Board::HEIGHT + 3;
+    static constexpr int MAX_NODES = 4 * NODE_COLUMNS * NODE_ROWS;
+
+    // Every node could in principle be a distinct resting position
+    static constexpr int MAX_PLACEMENTS = MAX_NODES;
+
+    // Longest input sequence getPath() can produce
+    static constexpr int MAX_PATH = MAX_NODES + NODE_ROWS;
+
+    PlacementEnumerator();
+
+    // Find the placements of piece, starting from its current position.
+    // Without soft drops only hard-drop placements are searched. Returns
+    // the count (0 if the piece does not fit where it is)
+    int enumerate(const Board& board, const Tetromino& piece, bool allowSoftDrop = true);
+
+    int size() const { return count; }
+    const Placement& operator[](int i) const { return placements[i]; }
+    const Placement* begin() const { return placements.data(); }
+    const Placement* end() const { return placements.data() + count; }
+
+    // Inputs that steer the piece from where enumerate() started to the
+    // placement, ending in HARD_DROP. out needs MAX_PATH entries when the
+    // path length is not known; returns the number written
+    int getPath(const Placement& placement, InputAction* out) const;
+
+private:
+    static_assert(NODE_COLUMNS <= 16, "Node columns must fit a uint16_t visited mask");
+
+    struct Node {
+        int8_t x, y;
+        int8_t rotation;
+        InputAction move;  // Input that reached this node from its parent
+        int16_t parent;    // -1 for the start node
+    };
+
+    std::array<Node, MAX_NODES> nodes;
+    std::array<Placement, MAX_PLACEMENTS> placements;
+    int count;
+
+    // Bit (x + 3) of [rotation][y + 3]: searched nodes / placements found
+    std::array<std::array<uint16_t, NODE_ROWS>, 4> visited;
+    std::array<std::array<uint16_t, NODE_ROWS>, 4> rested;
+
+    // Rotations whose cells match an earlier rotation (e.g. all of O),
+    // with the origin shift that lines their cells up
+    struct Canonical {
+        int8_t rotation;
+        int8_t dx, dy;
+    };
+    std::array<Canonical, 4> canonical;
+
+    void computeCanonical(TetrominoType type);
+    bool markVisited(int x, int y, int rotation);
+    void addPlacement(int x, int y, int rotation, bool tucked, int node);
+};
+
+#endif
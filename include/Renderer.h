@@ -5,9 +5,34 @@
 #include <string>
 #include <vector>
 #include "Board.h"
+#include "Font.h"
 #include "Tetromino.h"
 
 class Renderer {
+public:
+    // Block looks baked into the atlas: piece colors, line clear flash,
+    // ghost outlines and the dimmed colors of a locked hold slot
+    enum BlockVariant {
+        BLOCK_PIECE = 0,     // + TetrominoType
+        BLOCK_FLASH = 7,
+        BLOCK_GHOST = 8,     // + TetrominoType
+        BLOCK_DIMMED = 15,   // + TetrominoType
+        BLOCK_VARIANT_COUNT = 22
+    };
+
+    // Parts of the frame that Game invalidates when their inputs change.
+    // CHROME, BOARD and TITLE are cached in render-target textures; the
+    // rest is drawn directly whenever a frame is redrawn
+    enum RenderLayer : uint8_t {
+        LAYER_CHROME = 1 << 0,   // Background, board frame, grid, panel boxes
+        LAYER_BOARD = 1 << 1,    // Locked cells and the line clear flash
+        LAYER_PIECE = 1 << 2,    // Falling piece and ghost
+        LAYER_HUD = 1 << 3,      // Hold, next and stats
+        LAYER_OVERLAY = 1 << 4,  // Screen changes, pause and game over boxes
+        LAYER_TITLE = 1 << 5,    // Title screen
+        LAYER_ALL = 0x3F
+    };
+
 private:
     SDL_Window* window;
     SDL_Renderer* renderer;
@@ -26,25 +51,70 @@ private:
     int lineClearAnimFrame;
     std::vector<int> linesToClear;
 
+    // Block atlas: one row per block size, one column per BlockVariant
+    static constexpr int ATLAS_CELL = 32;
+    static constexpr int PREVIEW_BLOCK_SIZE = 16;
+    static constexpr int TITLE_BLOCK_SIZE = 24;
+    static constexpr int ATLAS_SIZE_COUNT = 3;
+
+    SDL_Texture* blockAtlas;
+    int atlasBlockSizes[ATLAS_SIZE_COUNT];
+    bool useBlockAtlas;
+
+    // Blocks queued for the current batch (capacity reserved in init)
+    std::vector<SDL_Vertex> blockVertices;
+    std::vector<int> blockIndices;
+
+    // HUD and overlay text
+    Font font;
+
+    // Retained layers (full-screen render targets, created on first use)
+    SDL_Texture* chromeLayer;
+    SDL_Texture* boardLayer;
+    SDL_Texture* titleLayer;
+    bool retainedLayers;
+    uint8_t dirtyLayers;
+
+    // Present in step with the display (set before init)
+    bool vsync;
+
+    void buildBlockAtlas();
+    void destroyBlockAtlas();
+    SDL_Color variantColor(int variant) const;
+
+    // Redraw a cached layer into its texture if dirty, then copy it out
+    template <typename DrawFn>
+    void drawLayer(SDL_Texture*& texture, uint8_t layer, SDL_BlendMode blendMode, DrawFn draw);
+    void destroyLayers();
+    void drawChrome();
+    void drawLockedCells(const Board& board);
+    void drawTitle();
+
 public:
     Renderer(int screenWidth = 800, int screenHeight = 600);
     ~Renderer();
 
     void init();
     void clear();
+    void setVSync(bool enabled) { vsync = enabled; }
 
     // Main rendering methods
     void renderGame(const Board& board, const Tetromino& currentPiece,
                     const Tetromino& nextPiece, int score, int highScore, int level, int lines,
                     const Tetromino* ghostPiece = nullptr,
                     const Tetromino* holdPiece = nullptr,
-                    bool canHold = true);
+                    bool canHold = true,
+                    float pieceOffset = 0.0f);  // Rows the falling piece is drawn above its cell
     void renderGameOver(int score, int highScore, int level, int lines);
     void renderPauseScreen();
     void renderTitleScreen();
     void present();
     bool isRunning() const;
 
+    // Dirty tracking: frames with no invalidated layer can be skipped
+    void invalidate(uint8_t layers) { dirtyLayers |= layers; }
+    bool needsRedraw() const { return dirtyLayers != 0; }
+
     // Line clear animation
     void startLineClearAnimation(const std::vector<int>& lines);
     bool updateLineClearAnimation();  // Returns true if animation is still playing
@@ -53,8 +123,22 @@ public:
     void renderRect(int x, int y, int w, int h, SDL_Color color);
     void renderBlock(int gridX, int gridY, SDL_Color color, bool isGhost = false);
     void renderBlockAt(int x, int y, int size, SDL_Color color, bool isGhost = false);
+
+    // Block batching: drawBlock queues a block from the atlas (or draws it
+    // directly when the atlas is off); flushBlocks submits the whole batch
+    void drawBlock(int x, int y, int size, int variant);
+    void drawBoardBlock(int gridX, int gridY, int variant);  // Board coordinates, buffer included
+    void flushBlocks();
+    void setBlockAtlasEnabled(bool enabled);
+    bool isBlockAtlasEnabled() const { return useBlockAtlas; }
+
+    // Recreate GPU resources after the render targets were lost
+    void handleTargetsReset();
+
+    // Dynamic text is batched per frame; fixed labels use cached textures
     void renderText(const std::string& text, int x, int y, SDL_Color color, int scale = 2);
-    std::string formatNumber(int number);
+    void renderStaticText(const std::string& text, int x, int y, SDL_Color color, int scale = 2);
+    static std::string formatNumber(int number);
 };
 
 #endif
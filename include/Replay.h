@@ -0,0 +1,98 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "GameCore.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// One input, applied just before the core's tick with this index
+struct ReplayEvent {
+    uint32_t tick;
+    InputAction action;
+};
+
+// A recorded game: seed, ruleset and every input in tick order.
+//
+// File layout (little endian):
+//   "TRPL"  magic
+//   u8      format version
+//   u64     seed
+//   u8      generator mode
+//   u16     line clear delay, in ticks
+//   u16     lock delay, in ticks
+//   u8      lock resets
+//   events  varint(ticks since previous event), u8 action
+//   end     varint(ticks since last event to the end of the game), u8 0xFF
+class Replay {
+public:
+    // Bumped whenever rule changes would make older replays play out differently
+    static constexpr uint8_t VERSION = 6;
+
+    Replay();
+
+    // Start a new recording for a core that was just reset
+    void begin(const GameCore& core);
+    void record(uint32_t tick, InputAction action);
+    void finish(uint32_t tick) { tickCount = tick; }
+
+    // Prepare a core to play this replay from tick 0
+    void setupCore(GameCore& core) const;
+
+    std::vector<uint8_t> encode() const;
+    bool decode(const std::vector<uint8_t>& bytes);
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+
+    uint64_t getSeed() const { return seed; }
+    GeneratorMode getMode() const { return mode; }
+    int getLineClearDelay() const { return lineClearDelay; }
+    int getLockDelay() const { return lockDelay; }
+    int getMaxLockResets() const { return maxLockResets; }
+    uint32_t getTickCount() const { return tickCount; }
+    const std::vector<ReplayEvent>& getEvents() const { return events; }
+
+private:
+    uint64_t seed;
+    GeneratorMode mode;
+    int lineClearDelay;
+    int lockDelay;
+    int maxLockResets;
+    uint32_t tickCount;
+    std::vector<ReplayEvent> events;
+};
+
+// Headless playback at full speed. Playing forward keeps a GameSnapshot every
+// snapshotInterval ticks, so seeking restores the nearest earlier snapshot
+// and simulates at most snapshotInterval - 1 ticks. The replay must
+// outlive the player
+class ReplayPlayer {
+public:
+    explicit ReplayPlayer(const Replay& replay, uint32_t snapshotInterval = 600);
+
+    // Simulate up to (not past) the given tick, or the end of the replay
+    void seek(uint32_t tick);
+    void runToEnd() { seek(replay.getTickCount()); }
+
+    bool atEnd() const;
+    uint32_t getTick() const { return core.getTickCount(); }
+    const GameCore& getCore() const { return core; }
+
+private:
+    struct Snapshot {
+        GameSnapshot state;
+        size_t nextEvent;
+    };
+
+    const Replay& replay;
+    uint32_t snapshotInterval;
+    GameCore core;
+    size_t nextEvent;
+    std::vector<Snapshot> snapshots;  // snapshots[i] is at tick i * snapshotInterval
+
+    void restart();
+    void step();
+};
+
+#endif
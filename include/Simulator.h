@@ -0,0 +1,48 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include "GameCore.h"
+#include "MovePolicy.h"
+#include <cstdint>
+#include <string>
+
+struct SimConfig {
+    int games = 1000;
+    int threads = 0;               // 0 = one per hardware thread
+    int maxPieces = 10000;         // Per-game cap so strong policies terminate
+    int gamesPerTask = 64;         // Batch size handed to the thread pool
+    uint64_t seed = 1;
+    GeneratorMode mode = GeneratorMode::UNIFORM;
+    std::string policy = "random";
+    int lookahead = 1;             // Preview pieces searched by the heuristic policy
+    int cacheBits = 0;             // Shared transposition table of 2^n slots (0 = none)
+};
+
+struct SimStats {
+    uint64_t games = 0;
+    uint64_t pieces = 0;
+    uint64_t lines = 0;
+    uint64_t totalScore = 0;
+    int bestScore = 0;
+    int threads = 0;
+    double seconds = 0.0;
+
+    double piecesPerSecond() const { return seconds > 0.0 ? pieces / seconds : 0.0; }
+    double piecesPerSecondPerCore() const { return threads > 0 ? piecesPerSecond() / threads : 0.0; }
+};
+
+// Runs many independent headless games in parallel on a work-stealing pool
+class Simulator {
+public:
+    explicit Simulator(const SimConfig& config);
+
+    SimStats run();
+
+    // Play one game to completion with the given policy
+    static void playGame(GameCore& core, MovePolicy& policy, int maxPieces);
+
+private:
+    SimConfig config;
+};
+
+#endif
@@ -1,7 +1,9 @@
 #ifndef TETROMINO_H
 #define TETROMINO_H
 
-#include <vector>
+#include <array>
+#include <cstdint>
+#include <utility>
 
 // Tetromino types
 enum TetrominoType {
@@ -14,6 +16,67 @@ enum TetrominoType {
     L = 6   // Orange
 };
 
+// Precomputed geometry of one tetromino type in one rotation state
+struct PieceMask {
+    int8_t cells[4][2];             // (col, row) offsets of the 4 occupied cells
+    uint8_t rows[4];                // Occupancy mask of each shape row (bit c = column c)
+    int8_t minX, maxX, minY, maxY;  // Bounding box of the cells within the 4x4 grid
+    int8_t columnBottoms[4];        // Lowest occupied row of each column (-1 = empty)
+};
+
+using PieceMaskTable = std::array<std::array<PieceMask, 4>, 7>;
+
+// Build the mask table from shape grids; evaluated at compile time
+constexpr PieceMaskTable buildPieceMasks(const bool (&shapes)[7][4][4][4]) {
+    PieceMaskTable table{};
+    for (int type = 0; type < 7; type++) {
+        for (int rotation = 0; rotation < 4; rotation++) {
+            PieceMask& mask = table[type][rotation];
+            mask.minX = mask.minY = 3;
+            mask.maxX = mask.maxY = 0;
+            for (int col = 0; col < 4; col++) {
+                mask.columnBottoms[col] = -1;
+            }
+
+            int count = 0;
+            for (int row = 0; row < 4; row++) {
+                for (int col = 0; col < 4; col++) {
+                    if (!shapes[type][rotation][row][col]) continue;
+
+                    mask.cells[count][0] = static_cast<int8_t>(col);
+                    mask.cells[count][1] = static_cast<int8_t>(row);
+                    mask.rows[row] |= static_cast<uint8_t>(1u << col);
+                    if (col < mask.minX) mask.minX = static_cast<int8_t>(col);
+                    if (col > mask.maxX) mask.maxX = static_cast<int8_t>(col);
+                    if (row < mask.minY) mask.minY = static_cast<int8_t>(row);
+                    if (row > mask.maxY) mask.maxY = static_cast<int8_t>(row);
+                    mask.columnBottoms[col] = static_cast<int8_t>(row);
+                    count++;
+                }
+            }
+        }
+    }
+    return table;
+}
+
+// Wall kick tests for one rotation: origin offsets (board coordinates,
+// y down) tried in order until the turned piece fits
+constexpr int MAX_KICKS = 6;
+struct KickList {
+    int8_t count;
+    int8_t offsets[MAX_KICKS][2];
+};
+
+// [type][from rotation][turn: 0 = clockwise, 1 = 180, 2 = counter-clockwise]
+using KickTable = std::array<std::array<std::array<KickList, 3>, 4>, 7>;
+
+// Four-byte piece record used by game snapshots
+struct PieceState {
+    int8_t type;
+    int8_t x, y;
+    int8_t rotation;
+};
+
 class Tetromino {
 private:
     TetrominoType type;
@@ -23,8 +86,17 @@ private:
     // Shape definitions for each tetromino and rotation state
     // grid[rotation][row][col]
     static const bool shapes[7][4][4][4];
-    
+
+    // Cell offsets, row masks and bounding boxes derived from shapes
+    static const PieceMaskTable masks;
+
+    // SRS wall kicks, built at compile time
+    static const KickTable kicks;
+
 public:
+    // Absolute board positions of the 4 occupied cells
+    using Cells = std::array<std::pair<int, int>, 4>;
+
     Tetromino(TetrominoType type = I, int startX = 3, int startY = 0);
     
     // Movement
@@ -34,9 +106,10 @@ public:
     void moveUp();
     
     // Rotation
-    void rotate();
+    void rotate();  // Same as rotateClockwise()
     void rotateClockwise();
     void rotateCounterClockwise();
+    void rotate180();
     
     // Getters
     TetrominoType getType() const;
@@ -44,12 +117,30 @@ public:
     int getY() const;
     int getRotation() const;
     const bool (*getShape() const)[4][4];
+    const PieceMask& getMask() const { return masks[type][rotation]; }
+    static const PieceMask& maskFor(TetrominoType type, int rotation) { return masks[type][rotation]; }
+
+    // Kicks for turning from rotation by quarter turns (1 = clockwise, 2, 3 = counter-clockwise)
+    static const KickList& kicksFor(TetrominoType type, int rotation, int turns) {
+        return kicks[type][rotation][turns - 1];
+    }
     
     // Setters
     void setPosition(int newX, int newY);
     
-    // Get occupied cells
-    std::vector<std::pair<int, int>> getOccupiedCells() const;
+    // Get occupied cells (fixed size, no allocation)
+    Cells getOccupiedCells() const;
+
+    PieceState getState() const {
+        return {static_cast<int8_t>(type), static_cast<int8_t>(x),
+                static_cast<int8_t>(y), static_cast<int8_t>(rotation)};
+    }
+    void setState(const PieceState& state) {
+        type = static_cast<TetrominoType>(state.type);
+        x = state.x;
+        y = state.y;
+        rotation = state.rotation;
+    }
 };
 
 #endif
@@ -0,0 +1,82 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing thread pool. Each worker owns a task deque: it pops new
+// work from the front of its own deque and, when that runs dry, steals
+// from the back of the other workers' deques. parallelFor bypasses the
+// deques: every worker runs one fixed range, so it never allocates.
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+    using RangeFunction = void (*)(const void* context, int begin, int end);
+
+    // threadCount <= 0 uses one worker per hardware thread
+    explicit ThreadPool(int threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Queue a task (on the calling worker's deque, or round-robin from outside)
+    void submit(Task task);
+
+    // Block until every submitted task has finished
+    void wait();
+
+    // Split [0, count) into one contiguous range per worker, run
+    // body(begin, end) on each and wait for all of them. Nothing is
+    // queued or allocated; called from one of this pool's own workers,
+    // the whole range runs on the caller
+    template <typename Body>
+    void parallelFor(int count, const Body& body) {
+        runRanges(count, [](const void* context, int begin, int end) {
+            (*static_cast<const Body*>(context))(begin, end);
+        }, &body);
+    }
+
+    int getThreadCount() const { return static_cast<int>(workers.size()); }
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::atomic<int> queuedTasks;   // Tasks sitting in a deque
+    std::atomic<int> pendingTasks;  // Tasks submitted but not finished
+    std::atomic<unsigned> nextQueue;
+    bool stopping;
+
+    std::mutex stateMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable allDone;
+
+    // Current parallelFor, published under stateMutex: each new generation
+    // wakes every worker to run its share of [0, rangeCount)
+    std::mutex rangeMutex;  // One parallelFor at a time
+    RangeFunction rangeFunction;
+    const void* rangeContext;
+    int rangeCount;
+    uint64_t rangeGeneration;
+    int rangesLeft;  // Workers still running the current generation
+
+    void workerLoop(int index);
+    bool popTask(int index, Task& task);
+    void runRanges(int count, RangeFunction function, const void* context);
+    void runRange(int index);
+};
+
+#endif
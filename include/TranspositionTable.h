@@ -0,0 +1,35 @@
+#ifndef TRANSPOSITION_TABLE_H
+#define TRANSPOSITION_TABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Fixed-size cache of search results keyed by 64-bit Zobrist keys, shared
+// by every search thread without locks. Each slot stores the value and
+// the value XORed with its key as two independent atomic words; a reader
+// that sees a torn write (one word from each of two stores) fails the key
+// check and treats it as a miss. New results always replace old ones.
+class TranspositionTable {
+public:
+    // 2^sizeLog2 slots of 16 bytes
+    explicit TranspositionTable(int sizeLog2 = 20);
+
+    bool probe(uint64_t key, double& value) const;
+    void store(uint64_t key, double value);
+    void clear();
+
+    size_t size() const { return mask + 1; }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> check;  // key ^ value
+        std::atomic<uint64_t> value;  // Bits of the double
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+};
+
+#endif
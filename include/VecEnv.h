@@ -0,0 +1,74 @@
+#ifndef VEC_ENV_H
+#define VEC_ENV_H
+
+#include "GameCore.h"
+#include "ThreadPool.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct VecEnvConfig {
+    int envs = 64;
+    int threads = 0;          // 0 = one per hardware thread, 1 = step on the caller
+    int ticksPerStep = 1;     // Simulation ticks after each action
+    uint64_t seed = 1;        // Base seed; every episode gets its own sequence
+    GeneratorMode mode = GeneratorMode::UNIFORM;
+};
+
+// N headless games stepped in lockstep for reinforcement learning. Each
+// step applies one action per game, advances the ticks and writes the
+// observations into contiguous buffers allocated up front, so stepping
+// never allocates. A game that ends reports done and is restarted with a
+// fresh seed in the same step; its observation is then the new game's
+// first state (the finished game's score is kept in getFinalScores()).
+class VecEnv {
+public:
+    // Action values are InputAction codes, plus one that does nothing
+    static constexpr uint8_t NOOP = static_cast<uint8_t>(InputAction::ROTATE_180) + 1;
+    static constexpr int ACTION_COUNT = NOOP + 1;
+
+    // Per game: the locked cells, then the falling piece, row-major (1 = filled)
+    static constexpr int PLANE_SIZE = Board::WIDTH * Board::HEIGHT;
+    static constexpr int OBSERVATION_SIZE = 2 * PLANE_SIZE;
+
+    // Per game: current, next and held piece type (-1 = empty hold)
+    static constexpr int PIECE_SLOTS = 3;
+
+    explicit VecEnv(const VecEnvConfig& config);
+
+    // Start every game over and fill the observations
+    void reset();
+
+    // actions holds one code per game
+    void step(const uint8_t* actions);
+
+    int size() const { return static_cast<int>(cores.size()); }
+
+    const uint8_t* getObservations() const { return observations.data(); }
+    const int8_t* getPieces() const { return pieces.data(); }
+    const int32_t* getScores() const { return scores.data(); }
+    const float* getRewards() const { return rewards.data(); }   // Score gained this step
+    const uint8_t* getDones() const { return dones.data(); }
+    const int32_t* getFinalScores() const { return finalScores.data(); }  // Valid where done
+
+    const GameCore& getCore(int env) const { return cores[env]; }
+
+private:
+    VecEnvConfig config;
+    std::vector<GameCore> cores;
+    std::vector<uint64_t> episodes;  // Episodes started per game, for seeding
+    std::unique_ptr<ThreadPool> pool;
+
+    std::vector<uint8_t> observations;
+    std::vector<int8_t> pieces;
+    std::vector<int32_t> scores;
+    std::vector<float> rewards;
+    std::vector<uint8_t> dones;
+    std::vector<int32_t> finalScores;
+
+    void resetEnv(int env);
+    void stepRange(const uint8_t* actions, int begin, int end);
+    void observe(int env);
+};
+
+#endif
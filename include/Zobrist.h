@@ -0,0 +1,41 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <array>
+#include <cstdint>
+
+// Fixed pseudo-random keys for Zobrist hashing: a position's hash is the
+// XOR of the keys of its parts, so adding or removing a part is one XOR
+namespace zobrist {
+
+constexpr int PIECE_SLOTS = 8;  // 0 = piece to play, 1-6 = previews, 7 = hold
+constexpr int HOLD_SLOT = 7;
+constexpr int PIECE_VALUES = 8;  // Types 0-6, plus 7 = hold already used
+
+template <int N>
+constexpr std::array<uint64_t, N> buildKeys(uint64_t seed) {
+    // splitmix64, evaluated at compile time
+    std::array<uint64_t, N> keys{};
+    for (int i = 0; i < N; i++) {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        keys[i] = z ^ (z >> 31);
+    }
+    return keys;
+}
+
+// One key per board cell; boards of every size share the same key prefix
+template <int CELLS>
+inline constexpr std::array<uint64_t, CELLS> cellKeys = buildKeys<CELLS>(0x5A0B157ull);
+
+inline constexpr std::array<uint64_t, PIECE_SLOTS * PIECE_VALUES> pieceKeys =
+    buildKeys<PIECE_SLOTS * PIECE_VALUES>(0x91EC35ull);
+
+template <int CELLS>
+inline uint64_t cellKey(int cell) { return cellKeys<CELLS>[cell]; }
+inline uint64_t pieceKey(int slot, int value) { return pieceKeys[slot * PIECE_VALUES + value]; }
+
+}  // namespace zobrist
+
+#endif
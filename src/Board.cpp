@@ -1,89 +1,265 @@
 #include "Board.h"
+#include "Zobrist.h"
 #include <algorithm>
+#include <cstring>
 
-Board::Board() {
+// Bit index of the lowest set bit of a row mask (any row width)
+template <typename Row>
+static inline int lowestColumn(Row mask) {
+    return __builtin_ctzll(static_cast<unsigned long long>(mask));
+}
+
+template <int W, int H, int BUFFER>
+BasicBoard<W, H, BUFFER>::BasicBoard() {
     clear();
 }
 
-void Board::clear() {
-    grid.assign(HEIGHT, std::vector<int>(WIDTH, -1));
+template <int W, int H, int BUFFER>
+void BasicBoard<W, H, BUFFER>::clear() {
+    rows.fill(0);
+    colors.fill(-1);
+    columnTops.fill(HEIGHT);
+    stackTop = HEIGHT;
+    hash = 0;
 }
 
-bool Board::canPlace(const Tetromino& piece) const {
-    auto cells = piece.getOccupiedCells();
-    
-    for (const auto& cell : cells) {
-        int px = cell.first;
-        int py = cell.second;
-        
-        // Check boundaries
-        if (px < 0 || px >= WIDTH || py < 0 || py >= HEIGHT) {
-            return false;
-        }
-        
-        // Check collision with existing pieces
-        if (grid[py][px] != -1) {
+template <int W, int H, int BUFFER>
+void BasicBoard<W, H, BUFFER>::snapshot(Snapshot& out) const {
+    out.rows = rows;
+    out.colors = colors;
+    out.columnTops = columnTops;
+    out.stackTop = static_cast<int8_t>(stackTop);
+    out.hash = hash;
+}
+
+template <int W, int H, int BUFFER>
+void BasicBoard<W, H, BUFFER>::restore(const Snapshot& in) {
+    rows = in.rows;
+    colors = in.colors;
+    columnTops = in.columnTops;
+    stackTop = in.stackTop;
+    hash = in.hash;
+}
+
+template <int W, int H, int BUFFER>
+bool BasicBoard<W, H, BUFFER>::canPlace(const Tetromino& piece) const {
+    return fits(piece.getMask(), piece.getX(), piece.getY());
+}
+
+template <int W, int H, int BUFFER>
+bool BasicBoard<W, H, BUFFER>::fits(const PieceMask& mask, int x, int y) const {
+    // Check boundaries against the precomputed bounding box
+    if (x + mask.minX < 0 || x + mask.maxX >= WIDTH ||
+        y + mask.minY < 0 || y + mask.maxY >= HEIGHT) {
+        return false;
+    }
+
+    // Check collision with existing pieces, one row mask at a time
+    for (int row = mask.minY; row <= mask.maxY; row++) {
+        Row rowMask = x >= 0 ? static_cast<Row>(Row(mask.rows[row]) << x) : static_cast<Row>(mask.rows[row] >> -x);
+        if (rows[y + row] & rowMask) {
             return false;
         }
     }
-    
+
     return true;
 }
 
-void Board::place(const Tetromino& piece) {
-    auto cells = piece.getOccupiedCells();
-    
-    for (const auto& cell : cells) {
-        int px = cell.first;
-        int py = cell.second;
-        
+template <int W, int H, int BUFFER>
+void BasicBoard<W, H, BUFFER>::place(const Tetromino& piece) {
+    const PieceMask& mask = piece.getMask();
+    int8_t color = static_cast<int8_t>(piece.getType());
+
+    for (const auto& cell : mask.cells) {
+        int px = piece.getX() + cell[0];
+        int py = piece.getY() + cell[1];
+
         if (px >= 0 && px < WIDTH && py >= 0 && py < HEIGHT) {
-            grid[py][px] = static_cast<int>(piece.getType());
+            Row bit = static_cast<Row>(Row(1) << px);
+            if (!(rows[py] & bit)) {
+                hash ^= zobrist::cellKey<HEIGHT * WIDTH>(py * WIDTH + px);
+            }
+            rows[py] |= bit;
+            colors[py * WIDTH + px] = color;
+            if (py < columnTops[px]) {
+                columnTops[px] = static_cast<int8_t>(py);
+            }
+            stackTop = std::min(stackTop, py);
         }
     }
 }
 
-int Board::clearLines() {
-    int linesCleared = 0;
-    int row = 0;
-    
-    while (row < HEIGHT) {
-        bool isLineFull = true;
-        
-        for (int col = 0; col < WIDTH; col++) {
-            if (grid[row][col] == -1) {
-                isLineFull = false;
-                break;
-            }
+template <int W, int H, int BUFFER>
+int BasicBoard<W, H, BUFFER>::getLandingY(const Tetromino& piece) const {
+    const PieceMask& mask = piece.getMask();
+    int x = piece.getX();
+    int y = piece.getY();
+
+    // While every column of the piece is still above that column's surface,
+    // the drop distance comes straight from the height profile
+    int drop = HEIGHT;
+    bool aboveSurface = true;
+    for (int col = mask.minX; col <= mask.maxX; col++) {
+        int bottom = y + mask.columnBottoms[col];
+        int top = columnTops[x + col];
+        if (bottom >= top) {
+            aboveSurface = false;
+            break;
+        }
+        drop = std::min(drop, top - 1 - bottom);
+    }
+    if (aboveSurface) {
+        return y + drop;
+    }
+
+    // Piece is tucked under an overhang: step down row by row
+    while (fits(mask, x, y + 1)) {
+        y++;
+    }
+    return y;
+}
+
+template <int W, int H, int BUFFER>
+int BasicBoard<W, H, BUFFER>::clearLines() {
+    ClearedRows cleared;
+    return clearLines(cleared);
+}
+
+template <int W, int H, int BUFFER>
+int BasicBoard<W, H, BUFFER>::clearLines(ClearedRows& cleared) {
+    cleared.count = 0;
+    if (!hasFullRow()) {
+        return 0;
+    }
+
+    // Single in-place compaction pass from the bottom: surviving rows are
+    // copied straight to their final position and full rows are skipped.
+    // Rows above the stack are empty and stay where they are
+    int fullRows[HEIGHT];
+    int count = 0;
+    int write = HEIGHT - 1;
+
+    for (int row = HEIGHT - 1; row >= stackTop; row--) {
+        Row mask = rows[row];
+        if (mask == FULL_ROW) {
+            fullRows[count++] = row;
+            hash ^= rowHash(row, mask);
+            continue;
         }
-        
-        if (isLineFull) {
-            // Remove the full line
-            grid.erase(grid.begin() + row);
-            // Add empty line at top
-            grid.insert(grid.begin(), std::vector<int>(WIDTH, -1));
-            linesCleared++;
-        } else {
-            row++;
+        if (write != row) {
+            // Every row below has been processed, so write's old cells are
+            // already out of the hash
+            hash ^= rowHash(row, mask) ^ rowHash(write, mask);
+            rows[write] = mask;
+            std::memcpy(&colors[write * WIDTH], &colors[row * WIDTH], WIDTH);
         }
+        write--;
+    }
+
+    // Vacated rows at the top of the stack become empty
+    for (; write >= stackTop; write--) {
+        rows[write] = 0;
+        std::memset(&colors[write * WIDTH], -1, WIDTH);
     }
-    
-    return linesCleared;
+
+    updateColumnTops();
+
+    // Report rows top to bottom
+    for (int i = 0; i < count; i++) {
+        cleared.rows[i] = fullRows[count - 1 - i];
+    }
+    cleared.count = count;
+    return count;
 }
 
-bool Board::isGameOver() const {
-    // Game is over if there are blocks in the top rows
-    for (int col = 0; col < WIDTH; col++) {
-        if (grid[0][col] != -1 || grid[1][col] != -1) {
-            return true;
+template <int W, int H, int BUFFER>
+int BasicBoard<W, H, BUFFER>::findFullRows(ClearedRows& full) const {
+    int count = 0;
+    if (hasFullRow()) {
+        for (int row = stackTop; row < HEIGHT; row++) {
+            if (rows[row] == FULL_ROW) {
+                full.rows[count++] = row;
+            }
         }
     }
-    return false;
+    full.count = count;
+    return count;
 }
 
-int Board::getCell(int x, int y) const {
+template <int W, int H, int BUFFER>
+bool BasicBoard<W, H, BUFFER>::hasFullRow() const {
+    // Branch-free scan of the stack; almost every call finds nothing
+    bool anyFull = false;
+    for (int row = stackTop; row < HEIGHT; row++) {
+        anyFull |= rows[row] == FULL_ROW;
+    }
+    return anyFull;
+}
+
+template <int W, int H, int BUFFER>
+void BasicBoard<W, H, BUFFER>::updateColumnTops() {
+    columnTops.fill(HEIGHT);
+
+    // Only called after cells were removed, so the stack top can only
+    // have moved down. Walk down from it until every column has its top
+    int top = stackTop;
+    stackTop = HEIGHT;
+    Row seen = 0;
+    for (int row = top; row < HEIGHT && seen != FULL_ROW; row++) {
+        if (!seen && rows[row]) {
+            stackTop = row;
+        }
+        for (Row fresh = rows[row] & ~seen; fresh; fresh &= fresh - 1) {
+            columnTops[lowestColumn(fresh)] = static_cast<int8_t>(row);
+        }
+        seen |= rows[row];
+    }
+}
+
+template <int W, int H, int BUFFER>
+uint64_t BasicBoard<W, H, BUFFER>::rowHash(int y, Row mask) {
+    uint64_t h = 0;
+    for (; mask; mask &= mask - 1) {
+        h ^= zobrist::cellKey<HEIGHT * WIDTH>(y * WIDTH + lowestColumn(mask));
+    }
+    return h;
+}
+
+template <int W, int H, int BUFFER>
+int BasicBoard<W, H, BUFFER>::getCell(int x, int y) const {
     if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) {
         return -2; // Out of bounds indicator
     }
-    return grid[y][x];
+    return colors[y * WIDTH + x];
+}
+
+template <int W, int H, int BUFFER>
+void BasicBoard<W, H, BUFFER>::setCell(int x, int y, int value) {
+    if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) {
+        return;
+    }
+
+    Row bit = static_cast<Row>(Row(1) << x);
+    bool wasFilled = rows[y] & bit;
+    if (wasFilled != (value >= 0)) {
+        hash ^= zobrist::cellKey<HEIGHT * WIDTH>(y * WIDTH + x);
+    }
+    if (value < 0) {
+        rows[y] &= static_cast<Row>(~bit);
+        colors[y * WIDTH + x] = -1;
+        updateColumnTops();
+    } else {
+        rows[y] |= bit;
+        colors[y * WIDTH + x] = static_cast<int8_t>(value);
+        if (y < columnTops[x]) {
+            columnTops[x] = static_cast<int8_t>(y);
+        }
+        stackTop = std::min(stackTop, y);
+    }
 }
+
+// The supported sizes; each is compiled with its dimensions folded in
+template class BasicBoard<10, 20, 4>;
+template class BasicBoard<10, 20, 20>;
+template class BasicBoard<20, 20, 4>;
+template class BasicBoard<64, 32, 4>;
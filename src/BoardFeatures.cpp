@@ -0,0 +1,237 @@
+#include "BoardFeatures.h"
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr uint16_t FULL = Board::FULL_ROW;
+constexpr uint16_t LEFT_WALL = 1;                               // Left of column 0, in row << 1
+constexpr uint16_t RIGHT_WALL = 1u << (Board::WIDTH - 1);       // Right of the last column, in row >> 1
+constexpr uint16_t BORDERED_WALLS = 1u | (1u << (Board::WIDTH + 1));  // Both walls around row << 1
+constexpr uint16_t BORDERED_PAIRS = (1u << (Board::WIDTH + 1)) - 1;   // Adjacent pairs incl. walls
+constexpr uint16_t COLUMN_PAIRS = (1u << (Board::WIDTH - 1)) - 1;     // Adjacent column pairs
+
+static_assert(Board::WIDTH + 2 <= 16, "Bordered rows must fit 16-bit lanes");
+
+// Without the POPCNT instruction __builtin_popcount is a library call
+inline int bitCount(uint32_t x) {
+#if defined(__POPCNT__)
+    return __builtin_popcount(x);
+#else
+    x = x - ((x >> 1) & 0x55555555u);
+    x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+    return static_cast<int>((((x + (x >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+#endif
+}
+
+void fillHeights(const Board& board, BoardFeatures& features) {
+    // Maintained by the board already; nothing to scan
+    for (int x = 0; x < Board::WIDTH; x++) {
+        features.columnHeights[x] = static_cast<int8_t>(board.getColumnHeight(x));
+    }
+}
+
+#if defined(__AVX2__) || defined(__SSE2__)
+
+// The kernel below, written once over a 16-bit lane vector type
+#if defined(__AVX2__)
+struct Lanes {
+    using Vec = __m256i;
+    static constexpr int COUNT = 16;
+
+    static Vec splat(uint16_t v) { return _mm256_set1_epi16(static_cast<short>(v)); }
+    static Vec zero() { return _mm256_setzero_si256(); }
+    static Vec bitAnd(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+    static Vec bitOr(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+    static Vec bitXor(Vec a, Vec b) { return _mm256_xor_si256(a, b); }
+    static Vec andNot(Vec a, Vec b) { return _mm256_andnot_si256(a, b); }  // ~a & b
+    static Vec add(Vec a, Vec b) { return _mm256_add_epi16(a, b); }
+    static Vec sub(Vec a, Vec b) { return _mm256_sub_epi16(a, b); }
+    static Vec isZero(Vec a) { return _mm256_cmpeq_epi16(a, zero()); }
+    template <int N> static Vec shiftLeft(Vec a) { return _mm256_slli_epi16(a, N); }
+    template <int N> static Vec shiftRight(Vec a) { return _mm256_srli_epi16(a, N); }
+    static void store(uint16_t* out, Vec a) { _mm256_storeu_si256(reinterpret_cast<Vec*>(out), a); }
+
+    static Vec gatherRow(const Board* boards, int y) {
+        return _mm256_setr_epi16(
+            static_cast<short>(boards[0].getRow(y)), static_cast<short>(boards[1].getRow(y)),
+            static_cast<short>(boards[2].getRow(y)), static_cast<short>(boards[3].getRow(y)),
+            static_cast<short>(boards[4].getRow(y)), static_cast<short>(boards[5].getRow(y)),
+            static_cast<short>(boards[6].getRow(y)), static_cast<short>(boards[7].getRow(y)),
+            static_cast<short>(boards[8].getRow(y)), static_cast<short>(boards[9].getRow(y)),
+            static_cast<short>(boards[10].getRow(y)), static_cast<short>(boards[11].getRow(y)),
+            static_cast<short>(boards[12].getRow(y)), static_cast<short>(boards[13].getRow(y)),
+            static_cast<short>(boards[14].getRow(y)), static_cast<short>(boards[15].getRow(y)));
+    }
+};
+#else
+struct Lanes {
+    using Vec = __m128i;
+    static constexpr int COUNT = 8;
+
+    static Vec splat(uint16_t v) { return _mm_set1_epi16(static_cast<short>(v)); }
+    static Vec zero() { return _mm_setzero_si128(); }
+    static Vec bitAnd(Vec a, Vec b) { return _mm_and_si128(a, b); }
+    static Vec bitOr(Vec a, Vec b) { return _mm_or_si128(a, b); }
+    static Vec bitXor(Vec a, Vec b) { return _mm_xor_si128(a, b); }
+    static Vec andNot(Vec a, Vec b) { return _mm_andnot_si128(a, b); }  // ~a & b
+    static Vec add(Vec a, Vec b) { return _mm_add_epi16(a, b); }
+    static Vec sub(Vec a, Vec b) { return _mm_sub_epi16(a, b); }
+    static Vec isZero(Vec a) { return _mm_cmpeq_epi16(a, zero()); }
+    template <int N> static Vec shiftLeft(Vec a) { return _mm_slli_epi16(a, N); }
+    template <int N> static Vec shiftRight(Vec a) { return _mm_srli_epi16(a, N); }
+    static void store(uint16_t* out, Vec a) { _mm_storeu_si128(reinterpret_cast<Vec*>(out), a); }
+
+    static Vec gatherRow(const Board* boards, int y) {
+        return _mm_setr_epi16(
+            static_cast<short>(boards[0].getRow(y)), static_cast<short>(boards[1].getRow(y)),
+            static_cast<short>(boards[2].getRow(y)), static_cast<short>(boards[3].getRow(y)),
+            static_cast<short>(boards[4].getRow(y)), static_cast<short>(boards[5].getRow(y)),
+            static_cast<short>(boards[6].getRow(y)), static_cast<short>(boards[7].getRow(y)));
+    }
+};
+#endif
+
+// Per-lane population count of 16-bit values (SWAR; no vector popcnt needed)
+Lanes::Vec popcount16(Lanes::Vec x) {
+    x = Lanes::sub(x, Lanes::bitAnd(Lanes::shiftRight<1>(x), Lanes::splat(0x5555)));
+    x = Lanes::add(Lanes::bitAnd(x, Lanes::splat(0x3333)),
+                   Lanes::bitAnd(Lanes::shiftRight<2>(x), Lanes::splat(0x3333)));
+    x = Lanes::bitAnd(Lanes::add(x, Lanes::shiftRight<4>(x)), Lanes::splat(0x0F0F));
+    return Lanes::bitAnd(Lanes::add(x, Lanes::shiftRight<8>(x)), Lanes::splat(0x001F));
+}
+
+// Same recurrences as extractFeatures(const Board&), Lanes::COUNT boards at once.
+// Every total stays below 2^16, so 16-bit lane sums cannot overflow
+void extractLanes(const Board* boards, BoardFeatures* out) {
+    using Vec = Lanes::Vec;
+    const Vec full = Lanes::splat(FULL);
+
+    Vec covered = Lanes::zero(), previous = Lanes::zero();
+    Vec height = Lanes::zero(), bumpiness = Lanes::zero(), holes = Lanes::zero();
+    Vec rowTransitions = Lanes::zero(), columnTransitions = Lanes::zero(), wells = Lanes::zero();
+
+    // Empty rows above every lane's stack add nothing to any feature
+    int top = Board::HEIGHT;
+    for (int lane = 0; lane < Lanes::COUNT; lane++) {
+        top = std::min(top, boards[lane].getStackTop());
+    }
+
+    for (int y = top; y < Board::HEIGHT; y++) {
+        Vec row = Lanes::gatherRow(boards, y);
+
+        holes = Lanes::add(holes, popcount16(Lanes::bitAnd(Lanes::andNot(row, full), covered)));
+        covered = Lanes::bitOr(covered, row);
+        height = Lanes::add(height, popcount16(covered));
+        bumpiness = Lanes::add(bumpiness, popcount16(Lanes::bitAnd(
+            Lanes::bitXor(covered, Lanes::shiftRight<1>(covered)), Lanes::splat(COLUMN_PAIRS))));
+
+        Vec bordered = Lanes::bitOr(Lanes::shiftLeft<1>(row), Lanes::splat(BORDERED_WALLS));
+        Vec changes = popcount16(Lanes::bitAnd(
+            Lanes::bitXor(bordered, Lanes::shiftRight<1>(bordered)), Lanes::splat(BORDERED_PAIRS)));
+        rowTransitions = Lanes::add(rowTransitions, Lanes::andNot(Lanes::isZero(covered), changes));
+
+        columnTransitions = Lanes::add(columnTransitions, popcount16(Lanes::bitXor(row, previous)));
+        previous = row;
+
+        Vec leftFilled = Lanes::bitOr(Lanes::shiftLeft<1>(row), Lanes::splat(LEFT_WALL));
+        Vec rightFilled = Lanes::bitOr(Lanes::shiftRight<1>(row), Lanes::splat(RIGHT_WALL));
+        Vec open = Lanes::andNot(covered, full);
+        wells = Lanes::add(wells, popcount16(Lanes::bitAnd(open, Lanes::bitAnd(leftFilled, rightFilled))));
+    }
+    columnTransitions = Lanes::add(columnTransitions, popcount16(Lanes::bitXor(previous, full)));
+
+    uint16_t sums[6][Lanes::COUNT];
+    Lanes::store(sums[0], height);
+    Lanes::store(sums[1], bumpiness);
+    Lanes::store(sums[2], holes);
+    Lanes::store(sums[3], rowTransitions);
+    Lanes::store(sums[4], columnTransitions);
+    Lanes::store(sums[5], wells);
+
+    for (int lane = 0; lane < Lanes::COUNT; lane++) {
+        BoardFeatures& features = out[lane];
+        fillHeights(boards[lane], features);
+        features.aggregateHeight = sums[0][lane];
+        features.bumpiness = sums[1][lane];
+        features.holes = sums[2][lane];
+        features.rowTransitions = sums[3][lane];
+        features.columnTransitions = sums[4][lane];
+        features.wells = sums[5][lane];
+    }
+}
+
+#endif
+
+}  // namespace
+
+BoardFeatures extractFeatures(const Board& board) {
+    BoardFeatures features;
+    fillHeights(board, features);
+
+    int height = 0, bumpiness = 0, holes = 0;
+    int rowTransitions = 0, columnTransitions = 0, wells = 0;
+    uint16_t covered = 0, previous = 0;
+
+    // Empty rows above the stack add nothing to any feature
+    for (int y = board.getStackTop(); y < Board::HEIGHT; y++) {
+        uint16_t row = board.getRow(y);
+
+        holes += bitCount(~row & covered & FULL);
+        covered |= row;
+
+        // A column covered at this row adds one to its height; a pair of
+        // neighbours with exactly one covered adds one to their difference
+        height += bitCount(covered);
+        bumpiness += bitCount((covered ^ (covered >> 1)) & COLUMN_PAIRS);
+
+        if (covered) {
+            uint32_t bordered = (static_cast<uint32_t>(row) << 1) | BORDERED_WALLS;
+            rowTransitions += bitCount((bordered ^ (bordered >> 1)) & BORDERED_PAIRS);
+        }
+
+        columnTransitions += bitCount(row ^ previous);
+        previous = row;
+
+        uint32_t leftFilled = (static_cast<uint32_t>(row) << 1) | LEFT_WALL;
+        uint32_t rightFilled = (row >> 1) | RIGHT_WALL;
+        wells += bitCount(~covered & FULL & leftFilled & rightFilled);
+    }
+    columnTransitions += bitCount(previous ^ FULL);
+
+    features.aggregateHeight = height;
+    features.bumpiness = bumpiness;
+    features.holes = holes;
+    features.rowTransitions = rowTransitions;
+    features.columnTransitions = columnTransitions;
+    features.wells = wells;
+    return features;
+}
+
+void extractFeatures(const Board* boards, size_t count, BoardFeatures* out) {
+    size_t i = 0;
+#if defined(__AVX2__) || defined(__SSE2__)
+    for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+        extractLanes(boards + i, out + i);
+    }
+#endif
+    for (; i < count; i++) {
+        out[i] = extractFeatures(boards[i]);
+    }
+}
+
+int countHoles(const Board& board) {
+    int holes = 0;
+    uint16_t covered = 0;
+    for (int y = board.getStackTop(); y < Board::HEIGHT; y++) {
+        uint16_t row = board.getRow(y);
+        holes += bitCount(~row & covered & FULL);
+        covered |= row;
+    }
+    return holes;
+}
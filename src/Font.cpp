@@ -0,0 +1,238 @@
+#include "Font.h"
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+
+namespace {
+
+struct Glyph {
+    char c;
+    uint8_t rows[Font::GLYPH_SIZE];
+};
+
+// Entry 0 is drawn for characters without a glyph
+constexpr Glyph glyphs[] = {
+    {'\0', {0x0E, 0x11, 0x11, 0x11, 0x0E}},
+    {'A', {0x0E, 0x11, 0x1F, 0x11, 0x11}},
+    {'B', {0x1E, 0x11, 0x1E, 0x11, 0x1E}},
+    {'C', {0x0E, 0x10, 0x10, 0x10, 0x0E}},
+    {'D', {0x1C, 0x12, 0x11, 0x12, 0x1C}},
+    {'E', {0x1F, 0x10, 0x1E, 0x10, 0x1F}},
+    {'F', {0x1F, 0x10, 0x1E, 0x10, 0x10}},
+    {'G', {0x0E, 0x10, 0x17, 0x11, 0x0E}},
+    {'H', {0x11, 0x11, 0x1F, 0x11, 0x11}},
+    {'I', {0x1F, 0x04, 0x04, 0x04, 0x1F}},
+    {'J', {0x07, 0x02, 0x02, 0x12, 0x0C}},
+    {'K', {0x12, 0x14, 0x18, 0x14, 0x12}},
+    {'L', {0x10, 0x10, 0x10, 0x10, 0x1F}},
+    {'M', {0x11, 0x1B, 0x15, 0x11, 0x11}},
+    {'N', {0x11, 0x19, 0x15, 0x13, 0x11}},
+    {'O', {0x0E, 0x11, 0x11, 0x11, 0x0E}},
+    {'P', {0x1E, 0x11, 0x1E, 0x10, 0x10}},
+    {'Q', {0x0E, 0x11, 0x11, 0x12, 0x0D}},
+    {'R', {0x1E, 0x11, 0x1E, 0x14, 0x12}},
+    {'S', {0x0F, 0x10, 0x0E, 0x01, 0x1E}},
+    {'T', {0x1F, 0x04, 0x04, 0x04, 0x04}},
+    {'U', {0x11, 0x11, 0x11, 0x11, 0x0E}},
+    {'V', {0x11, 0x11, 0x11, 0x0A, 0x04}},
+    {'W', {0x11, 0x11, 0x15, 0x1B, 0x11}},
+    {'X', {0x11, 0x0A, 0x04, 0x0A, 0x11}},
+    {'Y', {0x11, 0x0A, 0x04, 0x04, 0x04}},
+    {'Z', {0x1F, 0x02, 0x04, 0x08, 0x1F}},
+    {'0', {0x0E, 0x13, 0x15, 0x19, 0x0E}},
+    {'1', {0x04, 0x0C, 0x04, 0x04, 0x0E}},
+    {'2', {0x0E, 0x11, 0x06, 0x08, 0x1F}},
+    {'3', {0x1E, 0x01, 0x0E, 0x01, 0x1E}},
+    {'4', {0x12, 0x12, 0x1F, 0x02, 0x02}},
+    {'5', {0x1F, 0x10, 0x1E, 0x01, 0x1E}},
+    {'6', {0x0E, 0x10, 0x1E, 0x11, 0x0E}},
+    {'7', {0x1F, 0x02, 0x04, 0x08, 0x10}},
+    {'8', {0x0E, 0x11, 0x0E, 0x11, 0x0E}},
+    {'9', {0x0E, 0x11, 0x0F, 0x01, 0x0E}},
+    {':', {0x00, 0x04, 0x00, 0x04, 0x00}},
+    {'!', {0x04, 0x04, 0x04, 0x00, 0x04}},
+    {'/', {0x01, 0x02, 0x04, 0x08, 0x10}},
+    {'-', {0x00, 0x00, 0x1F, 0x00, 0x00}},
+    {',', {0x00, 0x00, 0x00, 0x04, 0x08}},
+    {'.', {0x00, 0x00, 0x00, 0x00, 0x04}},
+    {' ', {0x00, 0x00, 0x00, 0x00, 0x00}},
+};
+
+constexpr int GLYPH_COUNT = sizeof(glyphs) / sizeof(glyphs[0]);
+
+// ASCII code to glyph index, built at compile time
+constexpr std::array<uint8_t, 128> buildGlyphIndex() {
+    std::array<uint8_t, 128> index{};
+    for (int i = 1; i < GLYPH_COUNT; i++) {
+        index[static_cast<unsigned char>(glyphs[i].c)] = static_cast<uint8_t>(i);
+    }
+    return index;
+}
+
+constexpr std::array<uint8_t, 128> glyphIndex = buildGlyphIndex();
+
+int lookupGlyph(char c) {
+    unsigned char code = static_cast<unsigned char>(std::toupper(static_cast<unsigned char>(c)));
+    return code < 128 ? glyphIndex[code] : 0;
+}
+
+// Set the lit pixels of one glyph at originX in a white-on-transparent buffer
+void rasterizeGlyph(int glyph, int scale, std::vector<uint32_t>& pixels, int pitch, int originX) {
+    for (int row = 0; row < Font::GLYPH_SIZE; row++) {
+        for (int col = 0; col < Font::GLYPH_SIZE; col++) {
+            if (!(glyphs[glyph].rows[row] & (0x10 >> col))) continue;
+            for (int dy = 0; dy < scale; dy++) {
+                uint32_t* line = &pixels[(row * scale + dy) * pitch + originX + col * scale];
+                std::fill(line, line + scale, 0xFFFFFFFFu);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+Font::Font() : renderer(nullptr), batchScale(0) {
+    atlases.fill(nullptr);
+}
+
+Font::~Font() {
+    releaseTextures();
+}
+
+void Font::init(SDL_Renderer* target) {
+    releaseTextures();
+    renderer = target;
+
+    // Room for a screen full of HUD text in one batch
+    const int maxGlyphs = 512;
+    vertices.reserve(maxGlyphs * 4);
+    indices.reserve(maxGlyphs * 6);
+}
+
+const uint8_t* Font::getGlyph(char c) {
+    return glyphs[lookupGlyph(c)].rows;
+}
+
+int Font::measureText(const std::string& text, int scale) {
+    return static_cast<int>(text.size()) * GLYPH_ADVANCE * scale;
+}
+
+SDL_Texture* Font::createTexture(const std::vector<uint32_t>& pixels, int width, int height) {
+    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                             SDL_TEXTUREACCESS_STATIC, width, height);
+    if (!texture) {
+        std::cerr << "Font texture creation failed: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+    SDL_UpdateTexture(texture, nullptr, pixels.data(), width * static_cast<int>(sizeof(uint32_t)));
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    return texture;
+}
+
+SDL_Texture* Font::getAtlas(int scale) {
+    if (!atlases[scale]) {
+        // Every glyph side by side at this scale
+        int cell = GLYPH_SIZE * scale;
+        int width = GLYPH_COUNT * cell;
+        std::vector<uint32_t> pixels(width * cell, 0);
+        for (int glyph = 0; glyph < GLYPH_COUNT; glyph++) {
+            rasterizeGlyph(glyph, scale, pixels, width, glyph * cell);
+        }
+        atlases[scale] = createTexture(pixels, width, cell);
+    }
+    return atlases[scale];
+}
+
+void Font::drawText(const std::string& text, int x, int y, SDL_Color color, int scale) {
+    if (!renderer) return;
+    scale = std::max(1, std::min(scale, MAX_SCALE));
+
+    // A batch samples a single atlas
+    if (scale != batchScale) {
+        flush();
+        batchScale = scale;
+    }
+
+    const int cell = GLYPH_SIZE * scale;
+    const float atlasWidth = static_cast<float>(GLYPH_COUNT * cell);
+    const float y0 = static_cast<float>(y);
+    const float y1 = static_cast<float>(y + cell);
+
+    int cursorX = x;
+    for (char c : text) {
+        if (c != ' ') {
+            int glyph = lookupGlyph(c);
+            float u0 = glyph * cell / atlasWidth;
+            float u1 = (glyph + 1) * cell / atlasWidth;
+            float x0 = static_cast<float>(cursorX);
+            float x1 = static_cast<float>(cursorX + cell);
+
+            int base = static_cast<int>(vertices.size());
+            vertices.push_back({{x0, y0}, color, {u0, 0.0f}});
+            vertices.push_back({{x1, y0}, color, {u1, 0.0f}});
+            vertices.push_back({{x1, y1}, color, {u1, 1.0f}});
+            vertices.push_back({{x0, y1}, color, {u0, 1.0f}});
+
+            const int quad[6] = {0, 1, 2, 0, 2, 3};
+            for (int index : quad) {
+                indices.push_back(base + index);
+            }
+        }
+        cursorX += GLYPH_ADVANCE * scale;
+    }
+}
+
+void Font::drawStaticText(const std::string& text, int x, int y, SDL_Color color, int scale) {
+    if (!renderer || text.empty()) return;
+    scale = std::max(1, std::min(scale, MAX_SCALE));
+
+    std::string key = std::to_string(scale) + '|' + text;
+    auto it = staticTexts.find(key);
+    if (it == staticTexts.end()) {
+        int width = measureText(text, scale);
+        int height = GLYPH_SIZE * scale;
+        std::vector<uint32_t> pixels(width * height, 0);
+        for (size_t i = 0; i < text.size(); i++) {
+            rasterizeGlyph(lookupGlyph(text[i]), scale, pixels, width,
+                           static_cast<int>(i) * GLYPH_ADVANCE * scale);
+        }
+        it = staticTexts.emplace(key, createTexture(pixels, width, height)).first;
+    }
+
+    SDL_Texture* texture = it->second;
+    if (!texture) return;
+
+    // Labels never overlap other text, so this can go ahead of the queued glyphs
+    SDL_SetTextureColorMod(texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(texture, color.a);
+    SDL_Rect dest = {x, y, measureText(text, scale), GLYPH_SIZE * scale};
+    SDL_RenderCopy(renderer, texture, nullptr, &dest);
+}
+
+void Font::flush() {
+    if (indices.empty()) return;
+
+    SDL_Texture* atlas = getAtlas(batchScale);
+    if (atlas) {
+        SDL_RenderGeometry(renderer, atlas,
+                           vertices.data(), static_cast<int>(vertices.size()),
+                           indices.data(), static_cast<int>(indices.size()));
+    }
+    vertices.clear();
+    indices.clear();
+}
+
+void Font::releaseTextures() {
+    vertices.clear();
+    indices.clear();
+    for (SDL_Texture*& atlas : atlases) {
+        if (atlas) {
+            SDL_DestroyTexture(atlas);
+            atlas = nullptr;
+        }
+    }
+    for (auto& entry : staticTexts) {
+        if (entry.second) SDL_DestroyTexture(entry.second);
+    }
+    staticTexts.clear();
+}
@@ -1,24 +1,28 @@
 #include "Game.h"
 #include <iostream>
-#include <cstdlib>
-#include <ctime>
 #include <fstream>
+#include <algorithm>
+#include <random>
 #include <SDL2/SDL.h>
 
 Game::Game()
-    : currentPiece(I), nextPiece(L), ghostPiece(I),
-      holdPiece(nullptr), renderer(std::make_unique<Renderer>()),
-      score(0), highScore(0), level(1), lines(0), frameCounter(0),
-      gameOver(false), paused(false), running(true), canHold(true),
-      state(GameState::TITLE), dropSpeed(60), animFrameCounter(0) {
-    srand(static_cast<unsigned>(time(nullptr)));
+    : renderer(std::make_unique<Renderer>()),
+      highScore(0), paused(false), running(true),
+      state(GameState::TITLE), animFrameCounter(0), lastView(),
+      counterFrequency(SDL_GetPerformanceFrequency()), input(counterFrequency),
+      recording(false), gravityStepped(false), dropOffset(0.0f),
+      botLookahead(1), autoplay(false), botStep(0), botExpected(), botPieces(-1) {
+    dueActions.reserve(64);
+    botActions.reserve(64);
+    botPlan.reserve(64);
     loadHighScore();
 }
 
 void Game::init() {
     renderer->init();
-    board.clear();
-    spawnNewPiece();
+    // Keep completed rows on the board while the flash animation plays
+    core.setLineClearDelay(LINE_CLEAR_FRAMES);
+    resetGame();
     std::cout << "Tetris Game Started! Window should open..." << std::endl;
 }
 
@@ -28,7 +32,15 @@ void Game::handleInput() {
         switch (event.type) {
             case SDL_QUIT:
                 running = false;
-                gameOver = true;
+                break;
+            case SDL_RENDER_TARGETS_RESET:
+            case SDL_RENDER_DEVICE_RESET:
+                // Render target contents were lost; rebuild the block atlas
+                renderer->handleTargetsReset();
+                break;
+            case SDL_WINDOWEVENT:
+                // Exposed or resized: the window contents need a redraw
+                renderer->invalidate(Renderer::LAYER_OVERLAY);
                 break;
             case SDL_KEYDOWN:
                 // Handle input based on current state
@@ -37,6 +49,11 @@ void Game::handleInput() {
                         event.key.keysym.sym == SDLK_SPACE) {
                         state = GameState::PLAYING;
                         resetGame();
+                    } else if (event.key.keysym.sym == SDLK_b) {
+                        // Attract mode: start a game the bot plays
+                        state = GameState::PLAYING;
+                        resetGame();
+                        setAutoplay(true);
                     } else if (event.key.keysym.sym == SDLK_q) {
                         running = false;
                     }
@@ -45,43 +62,32 @@ void Game::handleInput() {
                         state = GameState::PLAYING;
                         paused = false;
                     } else if (event.key.keysym.sym == SDLK_q) {
-                        gameOver = true;
                         running = false;
                     }
-                } else if (state == GameState::PLAYING) {
+                } else if (state == GameState::GAME_OVER) {
+                    if (event.key.keysym.sym == SDLK_r) {
+                        resetGame();
+                        state = GameState::PLAYING;
+                    } else if (event.key.keysym.sym == SDLK_q) {
+                        running = false;
+                    }
+                } else if (state == GameState::PLAYING || state == GameState::LINE_CLEAR_ANIM) {
+                    // Gameplay keys (also buffered while rows clear)
+                    if (input.handleEvent(event, eventTime(event.key.timestamp))) break;
+                    if (state != GameState::PLAYING) break;
+
                     switch (event.key.keysym.sym) {
-                        case SDLK_a:
-                        case SDLK_LEFT:
-                            movePieceLeft();
-                            updateGhostPiece();
-                            break;
-                        case SDLK_d:
-                        case SDLK_RIGHT:
-                            movePieceRight();
-                            updateGhostPiece();
-                            break;
-                        case SDLK_w:
-                        case SDLK_UP:
-                            rotatePiece();
-                            updateGhostPiece();
-                            break;
-                        case SDLK_s:
-                        case SDLK_DOWN:
-                            movePieceDown();
-                            break;
-                        case SDLK_SPACE:
-                            // Hard drop
-                            while (movePieceDown());
-                            break;
-                        case SDLK_c:
-                            holdCurrentPiece();
-                            break;
                         case SDLK_p:
+                            // Keys pressed before the pause still count
+                            applyQueuedActions(SDL_GetPerformanceCounter());
+                            input.reset();
                             paused = true;
                             state = GameState::PAUSED;
                             break;
+                        case SDLK_b:
+                            setAutoplay(!autoplay);
+                            break;
                         case SDLK_q:
-                            gameOver = true;
                             running = false;
                             break;
                         default:
@@ -89,44 +95,167 @@ void Game::handleInput() {
                     }
                 }
                 break;
+            case SDL_KEYUP:
+                input.handleEvent(event, eventTime(event.key.timestamp));
+                break;
+        }
+    }
+}
+
+Uint64 Game::eventTime(Uint32 timestamp) const {
+    // Event timestamps are SDL_GetTicks() milliseconds; map them back onto the counter
+    Uint64 now = SDL_GetPerformanceCounter();
+    Uint32 age = SDL_GetTicks() - timestamp;
+    if (age > 1000) age = 0;  // Clock skew or wraparound: treat as just now
+    Uint64 ageCounts = static_cast<Uint64>(age) * counterFrequency / 1000;
+    return ageCounts < now ? now - ageCounts : 0;
+}
+
+void Game::applyQueuedActions(Uint64 until) {
+    input.collect(until, core.getGravity(), dueActions);
+    if (autoplay) {
+        // The bot has the controls
+        dueActions.clear();
+    }
+    for (const TimedAction& due : dueActions) {
+        if (state == GameState::PLAYING || state == GameState::LINE_CLEAR_ANIM) {
+            if (recording) replay.record(core.getTickCount(), due.action);
+            core.applyAction(due.action);
+            // Inputs show up immediately, not interpolated
+            gravityStepped = false;
         }
     }
+    dueActions.clear();
 }
 
 void Game::update() {
+    if (paused) return;
+
+    if (state == GameState::LINE_CLEAR_ANIM) {
+        renderer->updateLineClearAnimation();
+        core.tick();
+        if (!core.isClearingLines()) {
+            state = GameState::PLAYING;
+        }
+        return;
+    }
+
     if (state != GameState::PLAYING) return;
-    if (gameOver || paused) return;
 
-    frameCounter++;
+    if (autoplay) stepBot();
+
+    Tetromino before = core.getCurrentPiece();
+    int placedBefore = core.getPiecesPlaced();
+    core.tick();
+
+    // Gravity moved the same piece down one row: slide it there while rendering
+    const Tetromino& after = core.getCurrentPiece();
+    gravityStepped = core.getPiecesPlaced() == placedBefore &&
+                     after.getX() == before.getX() && after.getY() == before.getY() + 1 &&
+                     after.getRotation() == before.getRotation();
+
+    if (core.isGameOver()) {
+        state = GameState::GAME_OVER;
+        saveReplay();
+    } else if (core.isClearingLines()) {
+        // Flash the rows that were actually completed
+        const Board::ClearedRows& cleared = core.getLastClear();
+        renderer->startLineClearAnimation(
+            std::vector<int>(cleared.rows, cleared.rows + cleared.count));
+        state = GameState::LINE_CLEAR_ANIM;
+    }
+}
 
-    if (frameCounter >= dropSpeed) {
-        frameCounter = 0;
-        if (!movePieceDown()) {
-            lockPiece();
-            int clearedLines = board.clearLines();
+void Game::setAutoplay(bool enabled) {
+    autoplay = enabled;
+    if (autoplay && !bot) {
+        // Lookahead branches are searched on every core
+        bot = std::make_unique<HeuristicPolicy>(botLookahead, 0);
+        botCache = std::make_unique<TranspositionTable>();
+        bot->setTranspositionTable(botCache.get());
+    }
+    botActions.clear();
+    botStep = 0;
+    input.reset();
+    std::cout << "Autoplay " << (autoplay ? "on" : "off") << std::endl;
+}
 
-            if (clearedLines > 0) {
-                lines += clearedLines;
-                // Score calculation: more lines at once = more points
-                int lineBonus[] = {0, 100, 300, 500, 800};  // Single, Double, Triple, Tetris
-                score += lineBonus[clearedLines] * level;
+void Game::planBot() {
+    bot->chooseActions(core, botActions);
+    botStep = 0;
+    botExpected = core.getCurrentPiece().getState();
+    botPieces = core.getPiecesPlaced();
+
+    // Replay the plan on a copy of the game (no ticks, so no gravity) to
+    // find where each input should leave the piece
+    GameCore preview = core;
+    botPlan.clear();
+    for (InputAction action : botActions) {
+        preview.applyAction(action);
+        botPlan.push_back(preview.getCurrentPiece().getState());
+    }
+}
 
-                if (lines % 10 == 0) {
-                    increaseLevel();
-                }
-            }
+void Game::stepBot() {
+    PieceState now = core.getCurrentPiece().getState();
+    bool samePiece = core.getPiecesPlaced() == botPieces && now.type == botExpected.type;
 
-            spawnNewPiece();
+    // Gravity may already have carried the piece down through planned soft drops
+    while (samePiece && botStep < botActions.size() &&
+           botActions[botStep] == InputAction::SOFT_DROP && now.y >= botPlan[botStep].y) {
+        botExpected = botPlan[botStep++];
+    }
 
-            if (!board.canPlace(currentPiece)) {
-                gameOver = true;
-                state = GameState::GAME_OVER;
-            }
-        }
+    // Anywhere else (a blocked input, or gravity below the planned row) needs a new plan
+    bool onPlan = samePiece && now.x == botExpected.x && now.y == botExpected.y &&
+                  now.rotation == botExpected.rotation;
+    if (botActions.empty() || !onPlan || botStep == botActions.size()) {
+        planBot();
+    }
+    if (botStep == botActions.size()) return;
+
+    InputAction action = botActions[botStep];
+    botExpected = botPlan[botStep++];
+    if (recording) replay.record(core.getTickCount(), action);
+    core.applyAction(action);
+}
+
+void Game::trackChanges() {
+    const Tetromino& piece = core.getCurrentPiece();
+    const Tetromino* hold = core.getHoldPiece();
+    ViewState view = {state, piece.getType(), piece.getX(), piece.getY(), piece.getRotation(),
+                      core.getPiecesPlaced(), core.getLines(), core.getScore(), highScore,
+                      hold ? hold->getType() : -1, core.canHoldPiece(), dropOffset};
+
+    uint8_t layers = 0;
+    if (view.state != lastView.state) {
+        layers |= Renderer::LAYER_OVERLAY;
+    }
+    if (view.pieceType != lastView.pieceType || view.pieceX != lastView.pieceX ||
+        view.pieceY != lastView.pieceY || view.pieceRotation != lastView.pieceRotation ||
+        view.dropOffset != lastView.dropOffset) {
+        layers |= Renderer::LAYER_PIECE;
+    }
+    if (view.piecesPlaced != lastView.piecesPlaced || view.lines != lastView.lines) {
+        layers |= Renderer::LAYER_BOARD | Renderer::LAYER_HUD;
+    }
+    if (view.score != lastView.score || view.highScore != lastView.highScore ||
+        view.holdType != lastView.holdType || view.canHold != lastView.canHold) {
+        layers |= Renderer::LAYER_HUD;
     }
+    // The flash animation changes the locked cells every frame
+    if (view.state == GameState::LINE_CLEAR_ANIM || lastView.state == GameState::LINE_CLEAR_ANIM) {
+        layers |= Renderer::LAYER_BOARD;
+    }
+
+    lastView = view;
+    renderer->invalidate(layers);
 }
 
 void Game::render() {
+    // Nothing changed since the last frame: keep showing it
+    if (!renderer->needsRedraw()) return;
+
     renderer->clear();
 
     switch (state) {
@@ -135,23 +264,27 @@ void Game::render() {
             break;
 
         case GameState::PLAYING:
-            renderer->renderGame(board, currentPiece, nextPiece, score, highScore, level, lines,
-                                &ghostPiece, holdPiece.get(), canHold);
+            renderer->renderGame(core.getBoard(), core.getCurrentPiece(), core.getNextPiece(),
+                                core.getScore(), highScore, core.getLevel(), core.getLines(),
+                                &core.getGhostPiece(), core.getHoldPiece(), core.canHoldPiece(),
+                                dropOffset);
             break;
 
         case GameState::PAUSED:
-            renderer->renderGame(board, currentPiece, nextPiece, score, highScore, level, lines,
-                                &ghostPiece, holdPiece.get(), canHold);
+            renderer->renderGame(core.getBoard(), core.getCurrentPiece(), core.getNextPiece(),
+                                core.getScore(), highScore, core.getLevel(), core.getLines(),
+                                &core.getGhostPiece(), core.getHoldPiece(), core.canHoldPiece());
             renderer->renderPauseScreen();
             break;
 
         case GameState::GAME_OVER:
-            renderer->renderGameOver(score, highScore, level, lines);
+            renderer->renderGameOver(core.getScore(), highScore, core.getLevel(), core.getLines());
             break;
 
         case GameState::LINE_CLEAR_ANIM:
-            renderer->renderGame(board, currentPiece, nextPiece, score, highScore, level, lines,
-                                &ghostPiece, holdPiece.get(), canHold);
+            renderer->renderGame(core.getBoard(), core.getCurrentPiece(), core.getNextPiece(),
+                                core.getScore(), highScore, core.getLevel(), core.getLines(),
+                                &core.getGhostPiece(), core.getHoldPiece(), core.canHoldPiece());
             break;
     }
 
@@ -159,174 +292,73 @@ void Game::render() {
 }
 
 void Game::resetGame() {
-    // Reset game state
-    board.clear();
-    score = 0;
-    level = 1;
-    lines = 0;
-    frameCounter = 0;
-    gameOver = false;
+    // Reset game state with a fresh piece sequence
+    std::random_device seedSource;
+    core.reset((static_cast<uint64_t>(seedSource()) << 32) | seedSource());
+    replay.begin(core);
+    recording = true;
     paused = false;
-    dropSpeed = 60;
-    canHold = true;
-    holdPiece.reset();
-
-    // Spawn first piece
-    spawnNewPiece();
+    input.reset();
+    botActions.clear();
+    botStep = 0;
+    gravityStepped = false;
+    renderer->invalidate(Renderer::LAYER_ALL);
 }
 
 void Game::run() {
     init();
 
-    const int FPS = 60;
-    const int frameDelay = 1000 / FPS;
+    // Simulation time owed, in counter units scaled by TICK_RATE so one tick
+    // costs exactly counterFrequency
+    const Uint64 tickCost = counterFrequency;
+    Uint64 accumulator = 0;
+    Uint64 previous = SDL_GetPerformanceCounter();
 
     while (running) {
-        Uint32 frameStart = SDL_GetTicks();
+        Uint64 now = SDL_GetPerformanceCounter();
+        accumulator += (now - previous) * GameCore::TICK_RATE;
+        accumulator = std::min(accumulator, tickCost * MAX_CATCH_UP_TICKS);
+        previous = now;
 
         handleInput();
         if (!running) break;
+        input.syncKeyboardState(SDL_GetPerformanceCounter());
 
-        update();
-        render();
-
-        // Handle game over state
-        if (state == GameState::GAME_OVER) {
-            // Save high score if beaten
-            if (score > highScore) {
-                highScore = score;
-                saveHighScore();
-            }
-
-            // Wait for retry or quit
-            SDL_Event event;
-            while (SDL_PollEvent(&event)) {
-                if (event.type == SDL_QUIT) {
-                    running = false;
-                } else if (event.type == SDL_KEYDOWN) {
-                    if (event.key.keysym.sym == SDLK_r) {
-                        resetGame();
-                        state = GameState::PLAYING;
-                    } else if (event.key.keysym.sym == SDLK_q) {
-                        running = false;
-                    }
-                }
-            }
-        }
-
-        Uint32 frameTime = SDL_GetTicks() - frameStart;
-        if (frameDelay > frameTime) {
-            SDL_Delay(frameDelay - frameTime);
+        // Run every tick that is due, each after the input that preceded it
+        while (accumulator >= tickCost) {
+            accumulator -= tickCost;
+            applyQueuedActions(now - accumulator / GameCore::TICK_RATE);
+            update();
         }
-    }
-}
-
-void Game::spawnNewPiece() {
-    currentPiece = nextPiece;
-    currentPiece.setPosition(3, 0);
+        applyQueuedActions(now);
 
-    TetrominoType randomType = static_cast<TetrominoType>(rand() % 7);
-    nextPiece = Tetromino(randomType);
+        // Fraction of the current tick already elapsed
+        float alpha = static_cast<float>(accumulator) / static_cast<float>(tickCost);
+        dropOffset = (state == GameState::PLAYING && gravityStepped) ? 1.0f - alpha : 0.0f;
 
-    // Reset hold capability for new piece
-    canHold = true;
-
-    // Update ghost piece
-    updateGhostPiece();
-}
-
-void Game::updateGhostPiece() {
-    // Copy current piece to ghost
-    ghostPiece = currentPiece;
+        trackChanges();
+        bool redraw = renderer->needsRedraw();
+        render();
 
-    // Drop ghost piece to the bottom
-    while (true) {
-        ghostPiece.moveDown();
-        if (!board.canPlace(ghostPiece)) {
-            ghostPiece.moveUp();
-            break;
+        // Save high score if beaten (retry and quit keys are in handleInput)
+        if (state == GameState::GAME_OVER && core.getScore() > highScore) {
+            highScore = core.getScore();
+            saveHighScore();
         }
-    }
-}
-
-void Game::holdCurrentPiece() {
-    if (!canHold) return;
-
-    if (holdPiece) {
-        // Swap current with held piece
-        Tetromino temp = currentPiece;
-        currentPiece = *holdPiece;
-        currentPiece.setPosition(3, 0);
-        holdPiece = std::make_unique<Tetromino>(temp.getType());
-    } else {
-        // Store current piece and spawn new one
-        holdPiece = std::make_unique<Tetromino>(currentPiece.getType());
-        currentPiece = nextPiece;
-        currentPiece.setPosition(3, 0);
-
-        TetrominoType randomType = static_cast<TetrominoType>(rand() % 7);
-        nextPiece = Tetromino(randomType);
-    }
-
-    canHold = false;  // Can only hold once per piece drop
-    updateGhostPiece();
-}
 
-bool Game::movePieceDown() {
-    currentPiece.moveDown();
-
-    if (board.canPlace(currentPiece)) {
-        return true;
-    }
-
-    currentPiece.moveUp();
-    return false;
-}
-
-bool Game::movePieceLeft() {
-    currentPiece.moveLeft();
-
-    if (board.canPlace(currentPiece)) {
-        return true;
-    }
-
-    currentPiece.moveRight();
-    return false;
-}
-
-bool Game::movePieceRight() {
-    currentPiece.moveRight();
-
-    if (board.canPlace(currentPiece)) {
-        return true;
-    }
-
-    currentPiece.moveLeft();
-    return false;
-}
-
-bool Game::rotatePiece() {
-    currentPiece.rotate();
-
-    if (board.canPlace(currentPiece)) {
-        return true;
+        // Presenting waits for vsync; with nothing to draw, sleep until the
+        // next tick is due or an event arrives instead of spinning
+        if (!redraw) {
+            Uint64 owed = (tickCost - accumulator) / GameCore::TICK_RATE;
+            int waitMs = static_cast<int>(owed * 1000 / counterFrequency);
+            if (waitMs > 0) {
+                SDL_WaitEventTimeout(nullptr, waitMs);
+            }
+        }
     }
 
-    currentPiece.rotateCounterClockwise();
-    return false;
-}
-
-void Game::lockPiece() {
-    board.place(currentPiece);
-}
-
-void Game::increaseLevel() {
-    level++;
-    updateDropSpeed();
-}
-
-void Game::updateDropSpeed() {
-    dropSpeed = std::max(5, 60 - (level - 1) * 5);
+    // Keep the game in progress when quitting mid-game
+    saveReplay();
 }
 
 void Game::saveHighScore() {
@@ -337,6 +369,17 @@ void Game::saveHighScore() {
     }
 }
 
+void Game::saveReplay() {
+    // Nothing was played (e.g. quit from the title screen)
+    if (!recording || core.getTickCount() == 0) return;
+
+    replay.finish(core.getTickCount());
+    if (!replay.save(REPLAY_FILE)) {
+        std::cerr << "Could not write " << REPLAY_FILE << std::endl;
+    }
+    recording = false;
+}
+
 void Game::loadHighScore() {
     std::ifstream file("highscore.txt");
     if (file.is_open()) {
@@ -0,0 +1,400 @@
+#include "GameCore.h"
+#include "Zobrist.h"
+#include <algorithm>
+
+GameCore::GameCore(uint64_t seed, GeneratorMode mode)
+    : generator(seed, mode), currentPiece(I), nextPiece(L), ghostPiece(I), holdPiece(I),
+      hasHoldPiece(false), score(0), level(1), lines(0), piecesPlaced(0), tickCount(0),
+      gameOver(false), canHold(true), gravity(0), gravityRows(0),
+      lineClearDelay(0), lineClearTimer(0), lockDelay(DEFAULT_LOCK_DELAY),
+      maxLockResets(DEFAULT_LOCK_RESETS), lockTimer(0), lockResets(0), lowestRow(0) {
+    updateGravity();
+    updateGhostPiece();
+}
+
+void GameCore::reset() {
+    reset(generator.getSeed());
+}
+
+void GameCore::reset(uint64_t seed) {
+    // Reset game state
+    board.clear();
+    generator.reset(seed);
+    score = 0;
+    level = 1;
+    lines = 0;
+    piecesPlaced = 0;
+    tickCount = 0;
+    gameOver = false;
+    gravityRows = 0;
+    canHold = true;
+    hasHoldPiece = false;
+    lineClearTimer = 0;
+    updateGravity();
+    lastClear.count = 0;
+
+    // Spawn first piece
+    nextPiece = Tetromino(generator.next());
+    spawnNewPiece();
+}
+
+void GameCore::snapshot(GameSnapshot& out) const {
+    board.snapshot(out.board);
+    out.generator = generator;
+    out.gravityRows = gravityRows;
+    out.score = score;
+    out.level = level;
+    out.lines = lines;
+    out.piecesPlaced = piecesPlaced;
+    out.tickCount = tickCount;
+    out.currentPiece = currentPiece.getState();
+    out.nextPiece = nextPiece.getState();
+    out.ghostPiece = ghostPiece.getState();
+    out.holdPiece = holdPiece.getState();
+    out.lineClearTimer = static_cast<int16_t>(lineClearTimer);
+    out.lockTimer = static_cast<int16_t>(lockTimer);
+    out.lockResets = static_cast<int16_t>(lockResets);
+    out.lowestRow = static_cast<int8_t>(lowestRow);
+    out.clearedCount = static_cast<int8_t>(lastClear.count);
+    for (int i = 0; i < lastClear.count; i++) {
+        out.clearedRows[i] = static_cast<int8_t>(lastClear.rows[i]);
+    }
+    out.hasHoldPiece = hasHoldPiece;
+    out.canHold = canHold;
+    out.gameOver = gameOver;
+}
+
+void GameCore::restore(const GameSnapshot& in) {
+    board.restore(in.board);
+    generator = in.generator;
+    gravityRows = in.gravityRows;
+    score = in.score;
+    level = in.level;
+    lines = in.lines;
+    piecesPlaced = in.piecesPlaced;
+    tickCount = in.tickCount;
+    currentPiece.setState(in.currentPiece);
+    nextPiece.setState(in.nextPiece);
+    ghostPiece.setState(in.ghostPiece);
+    holdPiece.setState(in.holdPiece);
+    lineClearTimer = in.lineClearTimer;
+    lockTimer = in.lockTimer;
+    lockResets = in.lockResets;
+    lowestRow = in.lowestRow;
+    lastClear.count = in.clearedCount;
+    for (int i = 0; i < in.clearedCount; i++) {
+        lastClear.rows[i] = in.clearedRows[i];
+    }
+    hasHoldPiece = in.hasHoldPiece;
+    canHold = in.canHold;
+    gameOver = in.gameOver;
+
+    // Derived from the level
+    updateGravity();
+}
+
+uint64_t GameCore::getHash() const {
+    uint64_t hash = board.getHash() ^
+                    zobrist::pieceKey(0, currentPiece.getType()) ^
+                    zobrist::pieceKey(1, nextPiece.getType());
+    if (hasHoldPiece) hash ^= zobrist::pieceKey(zobrist::HOLD_SLOT, holdPiece.getType());
+    if (!canHold) hash ^= zobrist::pieceKey(zobrist::HOLD_SLOT, zobrist::PIECE_VALUES - 1);
+    return hash;
+}
+
+void GameCore::applyAction(InputAction action) {
+    if (gameOver || lineClearTimer > 0) return;
+
+    // Set when the piece moved sideways or turned
+    bool moved = false;
+
+    switch (action) {
+        case InputAction::MOVE_LEFT:
+            moved = movePieceLeft();
+            break;
+        case InputAction::MOVE_RIGHT:
+            moved = movePieceRight();
+            break;
+        case InputAction::ROTATE:
+            moved = rotatePiece(1);
+            break;
+        case InputAction::ROTATE_CCW:
+            moved = rotatePiece(3);
+            break;
+        case InputAction::ROTATE_180:
+            moved = rotatePiece(2);
+            break;
+        case InputAction::SOFT_DROP:
+            // A grounded piece ignores it and waits out its lock delay
+            if (movePieceDown()) trackLowestRow();
+            break;
+        case InputAction::HARD_DROP:
+            hardDropPiece();
+            break;
+        case InputAction::HOLD:
+            holdCurrentPiece();
+            break;
+        case InputAction::SHIFT_LEFT_FULL:
+            moved = shiftPieceFully(-1) > 0;
+            break;
+        case InputAction::SHIFT_RIGHT_FULL:
+            moved = shiftPieceFully(1) > 0;
+            break;
+    }
+
+    if (moved) {
+        updateGhostPiece();
+        restartLockDelay();
+    }
+}
+
+void GameCore::tick(int ticks) {
+    for (int i = 0; i < ticks && !gameOver; i++) {
+        tickCount++;
+
+        // Completed lines are waiting to be removed
+        if (lineClearTimer > 0) {
+            if (--lineClearTimer == 0) {
+                finishLock();
+            }
+            continue;
+        }
+
+        applyGravity();
+
+        // Falling: the lock delay starts over once the piece lands again
+        if (!isGrounded()) {
+            lockTimer = 0;
+            continue;
+        }
+
+        lockTimer++;
+        if (lockTimer > lockDelay || lockResets >= maxLockResets) {
+            lockPiece();
+        }
+    }
+}
+
+void GameCore::applyGravity() {
+    int landingY = ghostPiece.getY();
+    int y = currentPiece.getY();
+
+    if (gravity >= GRAVITY_20G) {
+        gravityRows = 0;
+    } else {
+        gravityRows += gravity;
+        if (gravityRows < GRAVITY_ONE) return;
+
+        // Whole rows due this tick; the piece falls through them unless it
+        // lands first, so no row by row collision tests are needed
+        landingY = std::min(landingY, y + (gravityRows >> GRAVITY_SHIFT));
+        gravityRows &= GRAVITY_ONE - 1;
+    }
+
+    if (landingY > y) {
+        currentPiece.setPosition(currentPiece.getX(), landingY);
+        trackLowestRow();
+    }
+}
+
+bool GameCore::isGrounded() const {
+    Tetromino below = currentPiece;
+    below.moveDown();
+    return !board.canPlace(below);
+}
+
+void GameCore::resetLockState() {
+    lockTimer = 0;
+    lockResets = 0;
+    lowestRow = currentPiece.getY();
+}
+
+void GameCore::trackLowestRow() {
+    // Reaching a new lowest row earns back every lock reset
+    if (currentPiece.getY() > lowestRow) {
+        lowestRow = currentPiece.getY();
+        lockResets = 0;
+    }
+}
+
+void GameCore::restartLockDelay() {
+    // Kicks can also push the piece down
+    trackLowestRow();
+
+    // Only a piece that has touched down is waiting to lock
+    if (lockTimer == 0 || lockResets >= maxLockResets) return;
+    lockTimer = 0;
+    lockResets++;
+}
+
+Tetromino GameCore::spawnPiece(const Board& board, TetrominoType type) {
+    Tetromino piece(type, SPAWN_X, SPAWN_Y);
+    // A spawn that overlaps the stack stays put so block out sees it
+    if (!board.canPlace(piece)) return piece;
+
+    piece.moveDown();
+    if (!board.canPlace(piece)) piece.moveUp();
+    return piece;
+}
+
+void GameCore::spawnNewPiece() {
+    currentPiece = spawnPiece(board, nextPiece.getType());
+    nextPiece = Tetromino(generator.next());
+
+    // Reset hold capability for new piece
+    canHold = true;
+    resetLockState();
+
+    // Update ghost piece
+    updateGhostPiece();
+}
+
+void GameCore::updateGhostPiece() {
+    // Copy current piece to ghost and drop it straight to its landing row
+    ghostPiece = currentPiece;
+    ghostPiece.setPosition(currentPiece.getX(), board.getLandingY(currentPiece));
+}
+
+void GameCore::holdCurrentPiece() {
+    if (!canHold) return;
+
+    if (hasHoldPiece) {
+        // Swap current with held piece
+        Tetromino temp = currentPiece;
+        currentPiece = spawnPiece(board, holdPiece.getType());
+        holdPiece = Tetromino(temp.getType());
+    } else {
+        // Store current piece and spawn new one
+        holdPiece = Tetromino(currentPiece.getType());
+        hasHoldPiece = true;
+        currentPiece = spawnPiece(board, nextPiece.getType());
+        nextPiece = Tetromino(generator.next());
+    }
+
+    canHold = false;  // Can only hold once per piece drop
+    resetLockState();
+    updateGhostPiece();
+}
+
+bool GameCore::movePieceDown() {
+    currentPiece.moveDown();
+
+    if (board.canPlace(currentPiece)) {
+        return true;
+    }
+
+    currentPiece.moveUp();
+    return false;
+}
+
+void GameCore::hardDropPiece() {
+    currentPiece.setPosition(currentPiece.getX(), board.getLandingY(currentPiece));
+    lockPiece();
+}
+
+bool GameCore::movePieceLeft() {
+    currentPiece.moveLeft();
+
+    if (board.canPlace(currentPiece)) {
+        return true;
+    }
+
+    currentPiece.moveRight();
+    return false;
+}
+
+bool GameCore::movePieceRight() {
+    currentPiece.moveRight();
+
+    if (board.canPlace(currentPiece)) {
+        return true;
+    }
+
+    currentPiece.moveLeft();
+    return false;
+}
+
+int GameCore::shiftPieceFully(int direction) {
+    int moved = 0;
+    while (direction < 0 ? movePieceLeft() : movePieceRight()) {
+        moved++;
+    }
+    return moved;
+}
+
+bool GameCore::rotatePiece(int turns) {
+    // SRS: the first kick offset where the turned piece fits wins
+    const KickList& kicks = Tetromino::kicksFor(currentPiece.getType(), currentPiece.getRotation(), turns);
+    PieceState state = currentPiece.getState();
+    Tetromino turned = currentPiece;
+
+    for (int i = 0; i < kicks.count; i++) {
+        turned.setState({state.type, static_cast<int8_t>(state.x + kicks.offsets[i][0]),
+                         static_cast<int8_t>(state.y + kicks.offsets[i][1]),
+                         static_cast<int8_t>((state.rotation + turns) & 3)});
+        if (board.canPlace(turned)) {
+            currentPiece = turned;
+            return true;
+        }
+    }
+    return false;
+}
+
+void GameCore::lockPiece() {
+    // Lock out: the whole piece came to rest above the visible field
+    bool lockedOut = currentPiece.getY() + currentPiece.getMask().maxY < Board::BUFFER_ROWS;
+
+    board.place(currentPiece);
+    piecesPlaced++;
+
+    if (lockedOut) {
+        gameOver = true;
+        return;
+    }
+
+    // Hold completed lines on the board for the clear delay
+    if (lineClearDelay > 0 && board.findFullRows(lastClear) > 0) {
+        lineClearTimer = lineClearDelay;
+        return;
+    }
+
+    finishLock();
+}
+
+void GameCore::finishLock() {
+    int clearedLines = board.clearLines(lastClear);
+
+    if (clearedLines > 0) {
+        lines += clearedLines;
+        // Score calculation: more lines at once = more points
+        int lineBonus[] = {0, 100, 300, 500, 800};  // Single, Double, Triple, Tetris
+        score += lineBonus[clearedLines] * level;
+
+        if (lines % 10 == 0) {
+            increaseLevel();
+        }
+    }
+
+    spawnNewPiece();
+
+    // Block out: the new piece overlaps the stack
+    if (!board.canPlace(currentPiece)) {
+        gameOver = true;
+    }
+}
+
+void GameCore::increaseLevel() {
+    level++;
+    updateGravity();
+}
+
+void GameCore::updateGravity() {
+    // Guideline marathon curve, (0.8 - (level - 1) * 0.007)^(level - 1)
+    // seconds per row, converted to rows per tick. Level 19 and up is 20G
+    static constexpr int32_t LEVEL_GRAVITY[] = {
+        1092,  1377,  1768,  2311,   3075,   4169,   5759,   8107,   11634,
+        17026, 25416, 38709, 60169,  95483,  154742, 256187, 433425, 749597,
+    };
+    constexpr int LEVELS = sizeof(LEVEL_GRAVITY) / sizeof(LEVEL_GRAVITY[0]);
+    gravity = level <= LEVELS ? LEVEL_GRAVITY[std::max(level, 1) - 1] : GRAVITY_20G;
+}
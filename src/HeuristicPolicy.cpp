@@ -0,0 +1,179 @@
+#include "HeuristicPolicy.h"
+#include "BoardFeatures.h"
+#include "Zobrist.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+// Topping out is worse than any board
+constexpr double LOSS = -std::numeric_limits<double>::infinity();
+
+// Each lookahead level needs its own enumerator, and tasks running on
+// different workers must not share them
+PlacementEnumerator& lookaheadEnumerator(int depth) {
+    thread_local std::array<PlacementEnumerator, HeuristicPolicy::MAX_LOOKAHEAD> enumerators;
+    return enumerators[depth - 1];
+}
+
+Tetromino pieceAt(TetrominoType type, const Placement& placement) {
+    Tetromino piece(type);
+    piece.setState({static_cast<int8_t>(type), placement.x, placement.y, placement.rotation});
+    return piece;
+}
+
+}  // namespace
+
+HeuristicPolicy::HeuristicPolicy(int lookahead, int threads, const HeuristicWeights& weights)
+    : lookahead(std::max(0, std::min(lookahead, MAX_LOOKAHEAD))), weights(weights), table(nullptr),
+      searchDepth(0) {
+    if (threads != 1) {
+        pool = std::make_unique<ThreadPool>(threads);
+    }
+    scores.reserve(2 * PlacementEnumerator::MAX_PLACEMENTS);
+}
+
+double HeuristicPolicy::evaluate(const Board& board) const {
+    if (board.isGameOver()) return LOSS;
+    return score(extractFeatures(board));
+}
+
+double HeuristicPolicy::score(const BoardFeatures& features) const {
+    return weights.aggregateHeight * features.aggregateHeight +
+           weights.holes * features.holes +
+           weights.bumpiness * features.bumpiness;
+}
+
+double HeuristicPolicy::search(const Board& board, const TetrominoType* upcoming, int depth) const {
+    if (depth == 0 || board.isGameOver()) return evaluate(board);
+
+    // The same board and pieces are often reached through different
+    // placement orders
+    uint64_t key = 0;
+    if (table) {
+        key = board.getHash();
+        for (int i = 0; i < depth; i++) {
+            key ^= zobrist::pieceKey(i, upcoming[i]);
+        }
+        double cached;
+        if (table->probe(key, cached)) return cached;
+    }
+
+    PlacementEnumerator& enumerator = lookaheadEnumerator(depth);
+    int count = enumerator.enumerate(board, GameCore::spawnPiece(board, upcoming[0]), false);
+
+    double best = LOSS;
+    if (depth == 1) {
+        // Last piece: lay the leaf boards out side by side and extract
+        // their features as one SIMD batch
+        thread_local std::vector<Board> leaves;
+        thread_local std::vector<int> leafLines;
+        thread_local std::vector<BoardFeatures> features;
+        leaves.resize(count);
+        leafLines.resize(count);
+        features.resize(count);
+
+        for (int i = 0; i < count; i++) {
+            leaves[i] = board;
+            leaves[i].place(pieceAt(upcoming[0], enumerator[i]));
+            leafLines[i] = leaves[i].clearLines();
+        }
+        extractFeatures(leaves.data(), count, features.data());
+
+        for (int i = 0; i < count; i++) {
+            if (leaves[i].isGameOver()) continue;
+            best = std::max(best, weights.lines * leafLines[i] + score(features[i]));
+        }
+    } else {
+        for (int i = 0; i < count; i++) {
+            Board next = board;
+            next.place(pieceAt(upcoming[0], enumerator[i]));
+            int cleared = next.clearLines();
+            best = std::max(best, weights.lines * cleared + search(next, upcoming + 1, depth - 1));
+        }
+    }
+
+    if (table) table->store(key, best);
+    return best;
+}
+
+double HeuristicPolicy::scoreRoot(const Board& board, const Option& option, const Tetromino& piece,
+                                  const Placement& placement) const {
+    Board next = board;
+    next.place(pieceAt(piece.getType(), placement));
+    int cleared = next.clearLines();
+    return weights.lines * cleared + search(next, option.upcoming.data(), searchDepth);
+}
+
+void HeuristicPolicy::chooseActions(const GameCore& core, std::vector<InputAction>& actions) {
+    const Board& board = core.getBoard();
+    const PieceGenerator& generator = core.getGenerator();
+    TetrominoType current = core.getCurrentPiece().getType();
+    TetrominoType next = core.getNextPiece().getType();
+    const Tetromino* held = core.getHoldPiece();
+
+    // Only visible pieces are searched. Both options must search the same
+    // depth for their scores to compare, and without a held piece option 0
+    // sees just the next one
+    searchDepth = std::min(lookahead, held ? 2 : 1);
+
+    // Option 0 plays the current piece where it is; the held piece can
+    // still be played after the next one by holding then
+    std::array<Tetromino, 2> roots = {core.getCurrentPiece(), Tetromino()};
+    std::array<int, 2> counts = {0, 0};
+    options[0].hold = false;
+    options[0].upcoming = {next, held ? held->getType() : next};
+    counts[0] = options[0].enumerator.enumerate(board, roots[0]);
+
+    // Option 1 holds first: out comes the held piece, or the next one if
+    // the slot is empty (which reveals the following preview piece), and
+    // the current piece waits in the slot
+    options[1].hold = true;
+    if (core.canHoldPiece()) {
+        if (held) {
+            roots[1] = GameCore::spawnPiece(board, held->getType());
+            options[1].upcoming = {next, current};
+        } else {
+            roots[1] = GameCore::spawnPiece(board, next);
+            options[1].upcoming = {generator.peek(0), current};
+        }
+        counts[1] = options[1].enumerator.enumerate(board, roots[1]);
+    }
+
+    scores.assign(counts[0] + counts[1], LOSS);
+
+    // One task per root placement; each writes only its own score
+    int slot = 0;
+    for (int o = 0; o < 2; o++) {
+        const Option& option = options[o];
+        const Tetromino& piece = roots[o];
+        for (int i = 0; i < counts[o]; i++) {
+            const Placement& placement = option.enumerator[i];
+            double& score = scores[slot++];
+            if (pool && lookahead > 0) {
+                pool->submit([this, &board, &option, &piece, &placement, &score] {
+                    score = scoreRoot(board, option, piece, placement);
+                });
+            } else {
+                score = scoreRoot(board, option, piece, placement);
+            }
+        }
+    }
+    if (pool) pool->wait();
+
+    actions.clear();
+    if (scores.empty()) {
+        actions.push_back(InputAction::HARD_DROP);
+        return;
+    }
+
+    // Ties keep the earlier (fewer input) placement, without holding
+    int best = static_cast<int>(std::max_element(scores.begin(), scores.end()) - scores.begin());
+    int o = best < counts[0] ? 0 : 1;
+    const Option& option = options[o];
+    const Placement& placement = option.enumerator[o == 0 ? best : best - counts[0]];
+
+    if (option.hold) actions.push_back(InputAction::HOLD);
+    int length = option.enumerator.getPath(placement, path.data());
+    actions.insert(actions.end(), path.begin(), path.begin() + length);
+}
@@ -0,0 +1,189 @@
+#include "InputHandler.h"
+#include <algorithm>
+
+namespace {
+
+// Two physical keys per action: WASD-style and the arrow/cluster key
+const SDL_Scancode bindings[][2] = {
+    {SDL_SCANCODE_A, SDL_SCANCODE_LEFT},     // KEY_LEFT
+    {SDL_SCANCODE_D, SDL_SCANCODE_RIGHT},    // KEY_RIGHT
+    {SDL_SCANCODE_S, SDL_SCANCODE_DOWN},     // KEY_SOFT_DROP
+    {SDL_SCANCODE_W, SDL_SCANCODE_UP},       // KEY_ROTATE
+    {SDL_SCANCODE_SPACE, SDL_SCANCODE_SPACE},  // KEY_HARD_DROP
+    {SDL_SCANCODE_C, SDL_SCANCODE_C},        // KEY_HOLD
+    {SDL_SCANCODE_Z, SDL_SCANCODE_LCTRL},    // KEY_ROTATE_CCW
+    {SDL_SCANCODE_X, SDL_SCANCODE_X},        // KEY_ROTATE_180
+};
+
+// Repeats emitted per collect() before skipping ahead (only hit after a stall)
+const int MAX_REPEATS = Board::WIDTH + Board::HEIGHT;
+
+}  // namespace
+
+InputHandler::InputHandler(Uint64 counterFrequency, const InputConfig& config)
+    : config(config), countsPerSecond(counterFrequency),
+      shiftDirection(0), nextShift(0), nextSoftDrop(0) {
+    events.reserve(64);
+    std::fill(held, held + KEY_COUNT, false);
+}
+
+int InputHandler::keyFor(SDL_Scancode scancode) {
+    for (int key = 0; key < KEY_COUNT; key++) {
+        if (bindings[key][0] == scancode || bindings[key][1] == scancode) {
+            return key;
+        }
+    }
+    return -1;
+}
+
+Uint64 InputHandler::millisToCounts(int ms) const {
+    return static_cast<Uint64>(std::max(ms, 0)) * countsPerSecond / 1000;
+}
+
+Uint64 InputHandler::softDropPeriod(int32_t gravity) const {
+    Uint64 factor = static_cast<Uint64>(std::max(config.softDropFactor, 1));
+    Uint64 rowsPerTick = static_cast<Uint64>(std::max(gravity, 1)) * factor;  // Fixed point
+    Uint64 period = countsPerSecond * GameCore::GRAVITY_ONE / (rowsPerTick * GameCore::TICK_RATE);
+    // One row per tick at most, so high gravity cannot flood the action
+    // queue with drops between two ticks
+    return std::max<Uint64>(period, countsPerSecond / GameCore::TICK_RATE);
+}
+
+bool InputHandler::handleEvent(const SDL_Event& event, Uint64 time) {
+    if (event.type != SDL_KEYDOWN && event.type != SDL_KEYUP) return false;
+
+    int key = keyFor(event.key.keysym.scancode);
+    if (key < 0) return false;
+
+    // OS auto-repeat is ignored; repeats are generated here
+    if (event.type == SDL_KEYDOWN && event.key.repeat) return true;
+
+    // Keep the queue in time order even if timestamps jitter
+    if (!events.empty()) {
+        time = std::max(time, events.back().time);
+    }
+    events.push_back({time, static_cast<Key>(key), event.type == SDL_KEYDOWN});
+    return true;
+}
+
+void InputHandler::syncKeyboardState(Uint64 now) {
+    const Uint8* keyboard = SDL_GetKeyboardState(nullptr);
+    if (!keyboard) return;
+
+    for (int key = 0; key < KEY_COUNT; key++) {
+        if (held[key] && !keyboard[bindings[key][0]] && !keyboard[bindings[key][1]]) {
+            if (!events.empty()) {
+                now = std::max(now, events.back().time);
+            }
+            events.push_back({now, static_cast<Key>(key), false});
+        }
+    }
+}
+
+void InputHandler::collect(Uint64 until, int32_t gravity, std::vector<TimedAction>& out) {
+    size_t consumed = 0;
+    while (consumed < events.size() && events[consumed].time <= until) {
+        // Repeats that came due before this event happen first
+        runRepeats(events[consumed].time, gravity, out);
+        applyEvent(events[consumed], gravity, out);
+        consumed++;
+    }
+    events.erase(events.begin(), events.begin() + consumed);
+
+    runRepeats(until, gravity, out);
+}
+
+void InputHandler::reset() {
+    events.clear();
+    std::fill(held, held + KEY_COUNT, false);
+    shiftDirection = 0;
+}
+
+void InputHandler::startShift(int direction, Uint64 time) {
+    shiftDirection = direction;
+    nextShift = time + millisToCounts(config.das);
+}
+
+void InputHandler::applyEvent(const KeyEvent& event, int32_t gravity,
+                              std::vector<TimedAction>& out) {
+    if (!event.down) {
+        held[event.key] = false;
+
+        // Releasing the active direction hands auto-shift back to the other one
+        int direction = event.key == KEY_LEFT ? -1 : event.key == KEY_RIGHT ? 1 : 0;
+        if (direction != 0 && direction == shiftDirection) {
+            Key other = direction < 0 ? KEY_RIGHT : KEY_LEFT;
+            if (held[other]) {
+                startShift(-direction, event.time);
+            } else {
+                shiftDirection = 0;
+            }
+        }
+        return;
+    }
+
+    if (held[event.key]) return;
+    held[event.key] = true;
+
+    switch (event.key) {
+        case KEY_LEFT:
+            out.push_back({event.time, InputAction::MOVE_LEFT});
+            startShift(-1, event.time);
+            break;
+        case KEY_RIGHT:
+            out.push_back({event.time, InputAction::MOVE_RIGHT});
+            startShift(1, event.time);
+            break;
+        case KEY_SOFT_DROP:
+            out.push_back({event.time, InputAction::SOFT_DROP});
+            nextSoftDrop = event.time + softDropPeriod(gravity);
+            break;
+        case KEY_ROTATE:
+            out.push_back({event.time, InputAction::ROTATE});
+            break;
+        case KEY_ROTATE_CCW:
+            out.push_back({event.time, InputAction::ROTATE_CCW});
+            break;
+        case KEY_ROTATE_180:
+            out.push_back({event.time, InputAction::ROTATE_180});
+            break;
+        case KEY_HARD_DROP:
+            out.push_back({event.time, InputAction::HARD_DROP});
+            break;
+        case KEY_HOLD:
+            out.push_back({event.time, InputAction::HOLD});
+            break;
+        default:
+            break;
+    }
+}
+
+void InputHandler::runRepeats(Uint64 until, int32_t gravity, std::vector<TimedAction>& out) {
+    const Uint64 never = ~static_cast<Uint64>(0);
+
+    for (int i = 0; i < MAX_REPEATS; i++) {
+        Uint64 shiftDue = shiftDirection != 0 ? nextShift : never;
+        Uint64 dropDue = held[KEY_SOFT_DROP] ? nextSoftDrop : never;
+        if (std::min(shiftDue, dropDue) > until) return;
+
+        if (shiftDue <= dropDue) {
+            if (config.arr <= 0) {
+                // Instant shift; re-applied every tick so new pieces slide too
+                out.push_back({shiftDue, shiftDirection < 0 ? InputAction::SHIFT_LEFT_FULL
+                                                            : InputAction::SHIFT_RIGHT_FULL});
+                nextShift += countsPerSecond / GameCore::TICK_RATE;
+            } else {
+                out.push_back({shiftDue, shiftDirection < 0 ? InputAction::MOVE_LEFT
+                                                            : InputAction::MOVE_RIGHT});
+                nextShift += millisToCounts(config.arr);
+            }
+        } else {
+            out.push_back({dropDue, InputAction::SOFT_DROP});
+            nextSoftDrop += softDropPeriod(gravity);
+        }
+    }
+
+    // Fell far behind (stalled loop): resume from now rather than replay every repeat
+    if (shiftDirection != 0 && nextShift <= until) nextShift = until + 1;
+    if (held[KEY_SOFT_DROP] && nextSoftDrop <= until) nextSoftDrop = until + 1;
+}
@@ -0,0 +1,103 @@
+#include "MovePolicy.h"
+#include "BoardFeatures.h"
+#include "HeuristicPolicy.h"
+#include <climits>
+
+std::unique_ptr<MovePolicy> MovePolicy::create(const std::string& name, uint64_t seed,
+                                               int lookahead, TranspositionTable* cache) {
+    if (name == "random") {
+        return std::make_unique<RandomPolicy>(seed);
+    }
+    if (name == "greedy") {
+        return std::make_unique<GreedyPolicy>();
+    }
+    if (name == "heuristic") {
+        // Games already run in parallel, so each searches on its own thread
+        auto policy = std::make_unique<HeuristicPolicy>(lookahead, 1);
+        policy->setTranspositionTable(cache);
+        return policy;
+    }
+    return nullptr;
+}
+
+void MovePolicy::appendPlacement(const GameCore& core, int rotation, int column,
+                                 std::vector<InputAction>& actions) {
+    const Tetromino& piece = core.getCurrentPiece();
+
+    int turns = (rotation - piece.getRotation() + 4) % 4;
+    if (turns == 1) actions.push_back(InputAction::ROTATE);
+    if (turns == 2) actions.push_back(InputAction::ROTATE_180);
+    if (turns == 3) actions.push_back(InputAction::ROTATE_CCW);
+
+    int shift = column - piece.getX();
+    InputAction step = shift < 0 ? InputAction::MOVE_LEFT : InputAction::MOVE_RIGHT;
+    for (int i = 0; i < (shift < 0 ? -shift : shift); i++) {
+        actions.push_back(step);
+    }
+
+    actions.push_back(InputAction::HARD_DROP);
+}
+
+RandomPolicy::RandomPolicy(uint64_t seed) : state(seed | 1) {}
+
+void RandomPolicy::chooseActions(const GameCore& core, std::vector<InputAction>& actions) {
+    // xorshift64*
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    uint64_t bits = state * 0x2545F4914F6CDD1Dull;
+
+    const PieceMask& mask = core.getCurrentPiece().getMask();
+    int rotation = static_cast<int>(bits & 3);
+    int minColumn = -mask.minX;
+    int maxColumn = Board::WIDTH - 1 - mask.maxX;
+    int column = minColumn + static_cast<int>((bits >> 8) % (maxColumn - minColumn + 1));
+
+    actions.clear();
+    appendPlacement(core, rotation, column, actions);
+}
+
+void GreedyPolicy::chooseActions(const GameCore& core, std::vector<InputAction>& actions) {
+    const Tetromino& current = core.getCurrentPiece();
+
+    const Placement* best = nullptr;
+    int bestLines = -1, bestHoles = INT_MAX, bestHeight = INT_MIN;
+
+    // Hard drops only: tucks need a smarter evaluation than this one
+    enumerator.enumerate(core.getBoard(), current, false);
+    for (const Placement& placement : enumerator) {
+        Tetromino piece(current.getType());
+        piece.setState({static_cast<int8_t>(current.getType()), placement.x, placement.y,
+                        placement.rotation});
+
+        // Score the board the placement leaves behind
+        Board board = core.getBoard();
+        board.place(piece);
+        int lines = board.clearLines();
+        int holes = countHoles(board);
+        int height = placement.y + piece.getMask().maxY;
+
+        bool better = lines > bestLines ||
+                      (lines == bestLines && holes < bestHoles) ||
+                      (lines == bestLines && holes == bestHoles && height > bestHeight);
+        // Full ties go to the lowest rotation, then the leftmost column
+        if (!better && best && lines == bestLines && holes == bestHoles && height == bestHeight) {
+            better = placement.rotation < best->rotation ||
+                     (placement.rotation == best->rotation && placement.x < best->x);
+        }
+        if (better) {
+            bestLines = lines;
+            bestHoles = holes;
+            bestHeight = height;
+            best = &placement;
+        }
+    }
+
+    actions.clear();
+    if (!best) {
+        actions.push_back(InputAction::HARD_DROP);
+        return;
+    }
+    int length = enumerator.getPath(*best, path.data());
+    actions.assign(path.begin(), path.begin() + length);
+}
@@ -0,0 +1,106 @@
+#include "PieceGenerator.h"
+#include <algorithm>
+
+static uint64_t splitmix64(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+PieceGenerator::PieceGenerator(uint64_t seed, GeneratorMode mode, int previewSize)
+    : seed(seed), mode(mode),
+      previewSize(std::max(1, std::min(previewSize, MAX_PREVIEW))),
+      head(0), count(0) {
+    reset(seed);
+}
+
+void PieceGenerator::reset(uint64_t newSeed) {
+    seed = newSeed;
+
+    uint64_t x = newSeed;
+    for (uint64_t& word : state) {
+        word = splitmix64(x);
+    }
+
+    head = 0;
+    count = 0;
+    while (count <= previewSize) {
+        refill();
+    }
+}
+
+TetrominoType PieceGenerator::next() {
+    TetrominoType type = static_cast<TetrominoType>(queue[head]);
+    head = (head + 1) % QUEUE_CAPACITY;
+    count--;
+
+    // Top the queue up in whole batches so the preview is always full
+    if (count <= previewSize) {
+        refill();
+    }
+    return type;
+}
+
+TetrominoType PieceGenerator::peek(int index) const {
+    return static_cast<TetrominoType>(queue[(head + index) % QUEUE_CAPACITY]);
+}
+
+void PieceGenerator::setMode(GeneratorMode newMode) {
+    mode = newMode;
+    reset(seed);
+}
+
+void PieceGenerator::setPreviewSize(int size) {
+    previewSize = std::max(1, std::min(size, MAX_PREVIEW));
+    while (count <= previewSize) {
+        refill();
+    }
+}
+
+uint64_t PieceGenerator::nextRandom() {
+    // xoshiro256**
+    uint64_t result = rotl(state[1] * 5, 7) * 9;
+    uint64_t t = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 45);
+
+    return result;
+}
+
+uint32_t PieceGenerator::nextBounded(uint32_t bound) {
+    // Multiply-shift range reduction; bias is negligible for bound <= 7
+    return static_cast<uint32_t>(((nextRandom() >> 32) * bound) >> 32);
+}
+
+void PieceGenerator::refill() {
+    uint8_t batch[7];
+
+    if (mode == GeneratorMode::SEVEN_BAG) {
+        // Fisher-Yates shuffle of one bag
+        for (int i = 0; i < 7; i++) {
+            batch[i] = static_cast<uint8_t>(i);
+        }
+        for (int i = 6; i > 0; i--) {
+            std::swap(batch[i], batch[nextBounded(i + 1)]);
+        }
+    } else {
+        for (uint8_t& piece : batch) {
+            piece = static_cast<uint8_t>(nextBounded(7));
+        }
+    }
+
+    for (uint8_t piece : batch) {
+        queue[(head + count) % QUEUE_CAPACITY] = piece;
+        count++;
+    }
+}
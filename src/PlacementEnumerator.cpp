@@ -0,0 +1,207 @@
+#include "PlacementEnumerator.h"
+#include <algorithm>
+
+PlacementEnumerator::PlacementEnumerator() : count(0) {}
+
+void PlacementEnumerator::computeCanonical(TetrominoType type) {
+    for (int rotation = 0; rotation < 4; rotation++) {
+        const PieceMask& mask = Tetromino::maskFor(type, rotation);
+        canonical[rotation] = {static_cast<int8_t>(rotation), 0, 0};
+
+        // Compare the shapes with their bounding boxes moved to the origin
+        for (int earlier = 0; earlier < rotation; earlier++) {
+            const PieceMask& other = Tetromino::maskFor(type, earlier);
+            if (mask.maxY - mask.minY != other.maxY - other.minY) continue;
+
+            bool same = true;
+            for (int row = 0; row <= mask.maxY - mask.minY && same; row++) {
+                same = (mask.rows[mask.minY + row] >> mask.minX) ==
+                       (other.rows[other.minY + row] >> other.minX);
+            }
+            if (same) {
+                canonical[rotation] = {static_cast<int8_t>(earlier),
+                                       static_cast<int8_t>(mask.minX - other.minX),
+                                       static_cast<int8_t>(mask.minY - other.minY)};
+                break;
+            }
+        }
+    }
+}
+
+bool PlacementEnumerator::markVisited(int x, int y, int rotation) {
+    uint16_t& row = visited[rotation][y + 3];
+    uint16_t bit = static_cast<uint16_t>(1u << (x + 3));
+    if (row & bit) return false;
+    row |= bit;
+    return true;
+}
+
+void PlacementEnumerator::addPlacement(int x, int y, int rotation, bool tucked, int node) {
+    // Dedupe on the cells covered, not on the rotation that covers them
+    const Canonical& key = canonical[rotation];
+    uint16_t& row = rested[key.rotation][y + key.dy + 3];
+    uint16_t bit = static_cast<uint16_t>(1u << (x + key.dx + 3));
+    if (row & bit) return;
+    row |= bit;
+
+    placements[count++] = {static_cast<int8_t>(x), static_cast<int8_t>(y),
+                           static_cast<int8_t>(rotation), tucked, static_cast<int16_t>(node)};
+}
+
+int PlacementEnumerator::enumerate(const Board& board, const Tetromino& piece, bool allowSoftDrop) {
+    count = 0;
+    for (auto& rows : visited) rows.fill(0);
+    for (auto& rows : rested) rows.fill(0);
+
+    if (!board.canPlace(piece)) return 0;
+
+    TetrominoType type = piece.getType();
+    computeCanonical(type);
+
+    int tail = 0;
+    nodes[tail++] = {static_cast<int8_t>(piece.getX()), static_cast<int8_t>(piece.getY()),
+                     static_cast<int8_t>(piece.getRotation()), InputAction::HARD_DROP, -1};
+    markVisited(piece.getX(), piece.getY(), piece.getRotation());
+
+    // Same single-step moves as GameCore; turns are in quarter turns
+    // clockwise and go through the SRS kick tests
+    struct Move {
+        InputAction action;
+        int dx, dy, turns;
+    };
+    static constexpr Move moves[] = {
+        {InputAction::MOVE_LEFT, -1, 0, 0},
+        {InputAction::MOVE_RIGHT, 1, 0, 0},
+        {InputAction::ROTATE, 0, 0, 1},
+        {InputAction::ROTATE_CCW, 0, 0, 3},
+        {InputAction::ROTATE_180, 0, 0, 2},
+        {InputAction::SOFT_DROP, 0, 1, 0},
+    };
+    constexpr int STEER_MOVES = 5;  // All but the soft drop
+
+    // Inlined canPlace(): the search makes hundreds of these tests
+    const PieceMask* masks[4];
+    for (int rotation = 0; rotation < 4; rotation++) {
+        masks[rotation] = &Tetromino::maskFor(type, rotation);
+    }
+    auto fits = [&](int x, int y, int rotation) {
+        const PieceMask& mask = *masks[rotation];
+        if (x + mask.minX < 0 || x + mask.maxX >= Board::WIDTH ||
+            y + mask.minY < 0 || y + mask.maxY >= Board::HEIGHT) {
+            return false;
+        }
+        for (int row = mask.minY; row <= mask.maxY; row++) {
+            uint32_t rowMask = x >= 0 ? mask.rows[row] << x : mask.rows[row] >> -x;
+            if (board.getRow(y + row) & rowMask) return false;
+        }
+        return true;
+    };
+
+    auto seen = [&](int x, int y, int rotation) {
+        return x >= -3 && x < NODE_COLUMNS - 3 && y >= -3 && y < NODE_ROWS - 3 &&
+               ((visited[rotation][y + 3] >> (x + 3)) & 1);
+    };
+
+    auto expand = [&](int index, int moveCount) {
+        const Node node = nodes[index];
+        for (int m = 0; m < moveCount; m++) {
+            const Move& move = moves[m];
+            int x = node.x + move.dx;
+            int y = node.y + move.dy;
+            int rotation = (node.rotation + move.turns) & 3;
+
+            // A searched node fits, so a turn would stop there on its first
+            // kick test too; most neighbours are skipped without a collision test
+            if (seen(x, y, rotation)) continue;
+
+            if (move.turns == 0) {
+                if (!fits(x, y, rotation)) continue;
+            } else {
+                // First kick that fits; in open space that is the first test
+                const KickList& kicks = Tetromino::kicksFor(type, node.rotation, move.turns);
+                int test = 0;
+                while (test < kicks.count &&
+                       !fits(x + kicks.offsets[test][0], y + kicks.offsets[test][1], rotation)) {
+                    test++;
+                }
+                if (test == kicks.count) continue;
+                x += kicks.offsets[test][0];
+                y += kicks.offsets[test][1];
+            }
+            if (!markVisited(x, y, rotation)) continue;
+
+            nodes[tail++] = {static_cast<int8_t>(x), static_cast<int8_t>(y),
+                             static_cast<int8_t>(rotation), move.action,
+                             static_cast<int16_t>(index)};
+        }
+    };
+
+    // Shifts and rotations at the starting row, each followed by a hard drop
+    for (int head = 0; head < tail; head++) {
+        expand(head, STEER_MOVES);
+    }
+    const int hardDropNodes = tail;
+    Tetromino probe(type);
+    for (int i = 0; i < hardDropNodes; i++) {
+        const Node& node = nodes[i];
+        probe.setState({static_cast<int8_t>(type), node.x, node.y, node.rotation});
+        addPlacement(node.x, board.getLandingY(probe), node.rotation, false, i);
+    }
+
+    if (!allowSoftDrop) return count;
+
+    // Rows above the highest filled cell are empty, so every (x, rotation)
+    // from the starting row can drop through them unchanged; search from a
+    // few rows above the stack instead of row by row from the top. The
+    // margin keeps rotations there that reach down into the stack
+    int stackTop = board.getStackTop();
+    for (int i = 0; i < hardDropNodes; i++) {
+        const Node node = nodes[i];
+        int clearY = std::min(stackTop - 4, stackTop - 1 - masks[node.rotation]->maxY);
+        if (clearY > node.y) {
+            if (markVisited(node.x, clearY, node.rotation)) {
+                nodes[tail++] = {node.x, static_cast<int8_t>(clearY), node.rotation,
+                                 InputAction::SOFT_DROP, static_cast<int16_t>(i)};
+            }
+        } else {
+            expand(i, STEER_MOVES + 1);
+        }
+    }
+
+    // Soft drops open up tucks and spins; anything new that rests is one
+    for (int head = hardDropNodes; head < tail; head++) {
+        expand(head, STEER_MOVES + 1);
+
+        const Node& node = nodes[head];
+        if (!fits(node.x, node.y + 1, node.rotation)) {
+            addPlacement(node.x, node.y, node.rotation, true, head);
+        }
+    }
+
+    return count;
+}
+
+int PlacementEnumerator::getPath(const Placement& placement, InputAction* out) const {
+    // Walk back to the start, then reverse
+    int length = 0;
+    for (int index = placement.node; nodes[index].parent >= 0; index = nodes[index].parent) {
+        const Node& node = nodes[index];
+        // One soft drop node may stand for several rows
+        int repeat = node.move == InputAction::SOFT_DROP ? node.y - nodes[node.parent].y : 1;
+        for (int i = 0; i < repeat; i++) {
+            out[length++] = node.move;
+        }
+    }
+    for (int i = 0; i < length / 2; i++) {
+        InputAction swap = out[i];
+        out[i] = out[length - 1 - i];
+        out[length - 1 - i] = swap;
+    }
+
+    // A hard drop covers any soft drops at the end
+    while (length > 0 && out[length - 1] == InputAction::SOFT_DROP) {
+        length--;
+    }
+    out[length++] = InputAction::HARD_DROP;
+    return length;
+}
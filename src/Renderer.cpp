@@ -3,6 +3,7 @@
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <algorithm>
 
 Renderer::Renderer(int screenWidth, int screenHeight)
     : window(nullptr), renderer(nullptr),
@@ -10,7 +11,10 @@ Renderer::Renderer(int screenWidth, int screenHeight)
       backgroundColor({18, 18, 28, 255}),
       borderColor({80, 100, 140, 255}),
       gridColor({35, 40, 55, 255}),
-      lineClearAnimFrame(0)
+      lineClearAnimFrame(0),
+      blockAtlas(nullptr), useBlockAtlas(false),
+      chromeLayer(nullptr), boardLayer(nullptr), titleLayer(nullptr),
+      retainedLayers(false), dirtyLayers(LAYER_ALL), vsync(true)
 {
     // Modern, softer color palette for tetrominoes
     pieceColors[0] = {0, 210, 210, 255};      // I - Cyan
@@ -24,9 +28,17 @@ Renderer::Renderer(int screenWidth, int screenHeight)
     // Calculate board position (centered more elegantly)
     boardX = 50;
     boardY = 50;
+
+    // Block sizes used by the board, the preview boxes and the title screen
+    atlasBlockSizes[0] = blockSize;
+    atlasBlockSizes[1] = PREVIEW_BLOCK_SIZE;
+    atlasBlockSizes[2] = TITLE_BLOCK_SIZE;
 }
 
 Renderer::~Renderer() {
+    destroyLayers();
+    destroyBlockAtlas();
+    font.releaseTextures();
     if (renderer) SDL_DestroyRenderer(renderer);
     if (window) SDL_DestroyWindow(window);
     SDL_Quit();
@@ -54,7 +66,7 @@ void Renderer::init() {
 
     renderer = SDL_CreateRenderer(
         window, -1,
-        SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC
+        SDL_RENDERER_ACCELERATED | (vsync ? SDL_RENDERER_PRESENTVSYNC : 0)
     );
 
     if (!renderer) {
@@ -70,6 +82,155 @@ void Renderer::init() {
                           backgroundColor.g,
                           backgroundColor.b,
                           backgroundColor.a);
+
+    // Room for a full board plus every piece and preview in one batch
+    const int maxBlocks = 512;
+    blockVertices.reserve(maxBlocks * 4);
+    blockIndices.reserve(maxBlocks * 6);
+
+    buildBlockAtlas();
+    font.init(renderer);
+
+    // Layer textures are created on first use
+    retainedLayers = SDL_RenderTargetSupported(renderer);
+    dirtyLayers = LAYER_ALL;
+}
+
+void Renderer::buildBlockAtlas() {
+    if (!SDL_RenderTargetSupported(renderer)) {
+        return;
+    }
+
+    blockAtlas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                   BLOCK_VARIANT_COUNT * ATLAS_CELL, ATLAS_SIZE_COUNT * ATLAS_CELL);
+    if (!blockAtlas) {
+        std::cerr << "Block atlas creation failed: " << SDL_GetError() << std::endl;
+        return;
+    }
+    SDL_SetTextureBlendMode(blockAtlas, SDL_BLENDMODE_BLEND);
+
+    // Pre-render every variant at every size with the immediate-mode path
+    SDL_SetRenderTarget(renderer, blockAtlas);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    for (int sizeIndex = 0; sizeIndex < ATLAS_SIZE_COUNT; sizeIndex++) {
+        for (int variant = 0; variant < BLOCK_VARIANT_COUNT; variant++) {
+            bool isGhost = variant >= BLOCK_GHOST && variant < BLOCK_DIMMED;
+            // Ghost outlines keep their own alpha; solid blocks blend highlights over the fill
+            SDL_SetRenderDrawBlendMode(renderer, isGhost ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
+            renderBlockAt(variant * ATLAS_CELL, sizeIndex * ATLAS_CELL,
+                          atlasBlockSizes[sizeIndex], variantColor(variant), isGhost);
+        }
+    }
+
+    SDL_SetRenderTarget(renderer, nullptr);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    useBlockAtlas = true;
+}
+
+void Renderer::destroyBlockAtlas() {
+    if (blockAtlas) {
+        SDL_DestroyTexture(blockAtlas);
+        blockAtlas = nullptr;
+    }
+    useBlockAtlas = false;
+}
+
+void Renderer::setBlockAtlasEnabled(bool enabled) {
+    flushBlocks();
+    if (enabled && !blockAtlas && renderer) {
+        buildBlockAtlas();
+    }
+    useBlockAtlas = enabled && blockAtlas != nullptr;
+}
+
+void Renderer::handleTargetsReset() {
+    bool wasEnabled = useBlockAtlas;
+    blockVertices.clear();
+    blockIndices.clear();
+    destroyBlockAtlas();
+    font.releaseTextures();
+    destroyLayers();
+    if (wasEnabled) {
+        buildBlockAtlas();
+    }
+}
+
+SDL_Color Renderer::variantColor(int variant) const {
+    if (variant == BLOCK_FLASH) {
+        return {255, 255, 255, 255};
+    }
+    if (variant >= BLOCK_DIMMED) {
+        SDL_Color color = pieceColors[variant - BLOCK_DIMMED];
+        color.r /= 2;
+        color.g /= 2;
+        color.b /= 2;
+        return color;
+    }
+    if (variant >= BLOCK_GHOST) {
+        return pieceColors[variant - BLOCK_GHOST];
+    }
+    return pieceColors[variant];
+}
+
+void Renderer::drawBlock(int x, int y, int size, int variant) {
+    int sizeIndex = -1;
+    for (int i = 0; i < ATLAS_SIZE_COUNT; i++) {
+        if (atlasBlockSizes[i] == size) {
+            sizeIndex = i;
+            break;
+        }
+    }
+
+    if (!useBlockAtlas || sizeIndex < 0) {
+        // Keep draw order: anything already queued goes first
+        flushBlocks();
+        bool isGhost = variant >= BLOCK_GHOST && variant < BLOCK_DIMMED;
+        renderBlockAt(x, y, size, variantColor(variant), isGhost);
+        return;
+    }
+
+    const float atlasWidth = static_cast<float>(BLOCK_VARIANT_COUNT * ATLAS_CELL);
+    const float atlasHeight = static_cast<float>(ATLAS_SIZE_COUNT * ATLAS_CELL);
+    float u0 = variant * ATLAS_CELL / atlasWidth;
+    float v0 = sizeIndex * ATLAS_CELL / atlasHeight;
+    float u1 = (variant * ATLAS_CELL + size) / atlasWidth;
+    float v1 = (sizeIndex * ATLAS_CELL + size) / atlasHeight;
+
+    float x0 = static_cast<float>(x), y0 = static_cast<float>(y);
+    float x1 = static_cast<float>(x + size), y1 = static_cast<float>(y + size);
+    const SDL_Color white = {255, 255, 255, 255};
+
+    int base = static_cast<int>(blockVertices.size());
+    blockVertices.push_back({{x0, y0}, white, {u0, v0}});
+    blockVertices.push_back({{x1, y0}, white, {u1, v0}});
+    blockVertices.push_back({{x1, y1}, white, {u1, v1}});
+    blockVertices.push_back({{x0, y1}, white, {u0, v1}});
+
+    const int quad[6] = {0, 1, 2, 0, 2, 3};
+    for (int index : quad) {
+        blockIndices.push_back(base + index);
+    }
+}
+
+void Renderer::drawBoardBlock(int gridX, int gridY, int variant) {
+    int screenRow = gridY - Board::BUFFER_ROWS;
+    drawBlock(boardX + gridX * blockSize, boardY + screenRow * blockSize, blockSize, variant);
+}
+
+void Renderer::flushBlocks() {
+    if (blockIndices.empty()) {
+        return;
+    }
+
+    // One draw call for every queued block
+    SDL_RenderGeometry(renderer, blockAtlas,
+                       blockVertices.data(), static_cast<int>(blockVertices.size()),
+                       blockIndices.data(), static_cast<int>(blockIndices.size()));
+    blockVertices.clear();
+    blockIndices.clear();
 }
 
 void Renderer::clear() {
@@ -127,10 +288,84 @@ void Renderer::renderGame(const Board& board, const Tetromino& currentPiece,
                           const Tetromino& nextPiece, int score, int highScore, int level, int lines,
                           const Tetromino* ghostPiece,
                           const Tetromino* holdPiece,
-                          bool canHold) {
+                          bool canHold,
+                          float pieceOffset) {
+    // Static frame and locked cells come from their cached layers
+    drawLayer(chromeLayer, LAYER_CHROME, SDL_BLENDMODE_NONE, [this] { drawChrome(); });
+    drawLayer(boardLayer, LAYER_BOARD, SDL_BLENDMODE_BLEND, [this, &board] { drawLockedCells(board); });
 
-    int boardWidth = 10 * blockSize;
-    int boardHeight = 20 * blockSize;
+    // ===== DRAW GHOST PIECE =====
+    if (ghostPiece) {
+        auto ghostCells = ghostPiece->getOccupiedCells();
+        for (const auto& cell : ghostCells) {
+            if (cell.second >= Board::BUFFER_ROWS && cell.second < board.getHeight()) {
+                drawBoardBlock(cell.first, cell.second, BLOCK_GHOST + ghostPiece->getType());
+            }
+        }
+    }
+
+    // ===== DRAW CURRENT PIECE =====
+    // Cells still in the hidden buffer are not drawn
+    int offsetPixels = static_cast<int>(pieceOffset * blockSize);
+    auto currentCells = currentPiece.getOccupiedCells();
+    for (const auto& cell : currentCells) {
+        if (cell.second >= Board::BUFFER_ROWS && cell.second < board.getHeight()) {
+            int screenRow = cell.second - Board::BUFFER_ROWS;
+            drawBlock(boardX + cell.first * blockSize, boardY + screenRow * blockSize - offsetPixels,
+                      blockSize, BLOCK_PIECE + currentPiece.getType());
+        }
+    }
+
+    int boardWidth = Board::WIDTH * blockSize;
+    int panelX = boardX + boardWidth + 40;
+    int panelY = boardY;
+
+    // ===== HOLD PIECE BOX =====
+    int holdBoxY = panelY + 15;
+    SDL_Rect holdBox = {panelX - 10, holdBoxY, 100, 90};
+    SDL_SetRenderDrawColor(renderer, canHold ? (Uint8)60 : (Uint8)40, canHold ? (Uint8)90 : (Uint8)50, canHold ? (Uint8)140 : (Uint8)80, 255);
+    SDL_RenderDrawRect(renderer, &holdBox);
+
+    renderStaticText("HOLD", panelX + 15, holdBoxY + 5, canHold ? SDL_Color{150, 180, 220, 255} : SDL_Color{80, 80, 100, 255});
+
+    if (holdPiece) {
+        auto holdCells = holdPiece->getOccupiedCells();
+        int holdVariant = (canHold ? BLOCK_PIECE : BLOCK_DIMMED) + holdPiece->getType();
+        for (const auto& cell : holdCells) {
+            int px = panelX + cell.first * 18 + 8;
+            int py = holdBoxY + cell.second * 18 + 30;
+            drawBlock(px, py, PREVIEW_BLOCK_SIZE, holdVariant);
+        }
+    }
+
+    // ===== NEXT PIECE =====
+    int nextBoxY = holdBoxY + 100;
+    auto nextCells = nextPiece.getOccupiedCells();
+    for (const auto& cell : nextCells) {
+        int px = panelX + cell.first * 18 + 8;
+        int py = nextBoxY + cell.second * 18 + 30;
+        drawBlock(px, py, PREVIEW_BLOCK_SIZE, BLOCK_PIECE + nextPiece.getType());
+    }
+
+    // ===== STATS =====
+    int statsBoxY = nextBoxY + 105;
+    renderText(formatNumber(score), panelX + 10, statsBoxY + 30, {255, 240, 100, 255});
+    renderText(formatNumber(highScore), panelX + 10, statsBoxY + 75, {255, 200, 80, 255});
+    renderText(std::to_string(level), panelX + 10, statsBoxY + 120, {100, 255, 180, 255});
+    renderText(formatNumber(lines), panelX + 10, statsBoxY + 165, {255, 150, 200, 255});
+
+    // Submit every queued block and glyph in one batch each
+    flushBlocks();
+    font.flush();
+}
+
+// Everything on the game screen that never changes: background, board
+// frame and grid, panel boxes and their labels
+void Renderer::drawChrome() {
+    clear();
+
+    int boardWidth = Board::WIDTH * blockSize;
+    int boardHeight = Board::VISIBLE_HEIGHT * blockSize;
 
     // ===== BOARD BACKGROUND =====
     // Outer glow effect
@@ -149,66 +384,17 @@ void Renderer::renderGame(const Board& board, const Tetromino& currentPiece,
 
     // Draw subtle grid
     SDL_SetRenderDrawColor(renderer, 30, 35, 50, 150);
-    for (int i = 0; i <= 10; i++) {
+    for (int i = 0; i <= Board::WIDTH; i++) {
         SDL_RenderDrawLine(renderer,
                           boardX + i * blockSize, boardY,
                           boardX + i * blockSize, boardY + boardHeight);
     }
-    for (int i = 0; i <= 20; i++) {
+    for (int i = 0; i <= Board::VISIBLE_HEIGHT; i++) {
         SDL_RenderDrawLine(renderer,
                           boardX, boardY + i * blockSize,
                           boardX + boardWidth, boardY + i * blockSize);
     }
 
-    // ===== DRAW GHOST PIECE =====
-    if (ghostPiece) {
-        auto ghostCells = ghostPiece->getOccupiedCells();
-        for (const auto& cell : ghostCells) {
-            if (cell.second >= 0 && cell.second < board.getHeight()) {
-                renderBlock(cell.first, cell.second,
-                           pieceColors[ghostPiece->getType()], true);
-            }
-        }
-    }
-
-    // ===== DRAW LOCKED PIECES =====
-    const auto& grid = board.getGrid();
-    for (int row = 0; row < board.getHeight(); row++) {
-        for (int col = 0; col < board.getWidth(); col++) {
-            if (grid[row][col] != -1) {
-                // Check if this row is being cleared (for animation)
-                bool isClearing = false;
-                for (int clearRow : linesToClear) {
-                    if (row == clearRow) {
-                        isClearing = true;
-                        break;
-                    }
-                }
-
-                if (isClearing && lineClearAnimFrame > 0) {
-                    // Flash effect during line clear
-                    SDL_Color flashColor = {255, 255, 255, 255};
-                    if (lineClearAnimFrame % 4 < 2) {
-                        renderBlock(col, row, flashColor);
-                    } else {
-                        renderBlock(col, row, pieceColors[grid[row][col]]);
-                    }
-                } else {
-                    renderBlock(col, row, pieceColors[grid[row][col]]);
-                }
-            }
-        }
-    }
-
-    // ===== DRAW CURRENT PIECE =====
-    auto currentCells = currentPiece.getOccupiedCells();
-    for (const auto& cell : currentCells) {
-        if (cell.second >= 0 && cell.second < board.getHeight()) {
-            renderBlock(cell.first, cell.second,
-                       pieceColors[currentPiece.getType()]);
-        }
-    }
-
     // ===== RIGHT SIDE PANEL =====
     int panelX = boardX + boardWidth + 40;
     int panelY = boardY;
@@ -217,36 +403,17 @@ void Renderer::renderGame(const Board& board, const Tetromino& currentPiece,
     SDL_SetRenderDrawColor(renderer, 60, 100, 180, 80);
     SDL_Rect titleGlow = {panelX - 15, panelY - 45, 220, 35};
     SDL_RenderFillRect(renderer, &titleGlow);
-    renderText("TETRIS", panelX + 45, panelY - 38, {100, 180, 255, 255}, 3);
+    renderStaticText("TETRIS", panelX + 45, panelY - 38, {100, 180, 255, 255}, 3);
 
     // Decorative line under title
     SDL_SetRenderDrawColor(renderer, 60, 100, 160, 255);
     SDL_RenderDrawLine(renderer, panelX - 10, panelY, panelX + 200, panelY);
 
-    // ===== HOLD PIECE BOX =====
+    // ===== HOLD PIECE BOX (border and label depend on canHold) =====
     int holdBoxY = panelY + 15;
     SDL_SetRenderDrawColor(renderer, 25, 28, 40, 220);
     SDL_Rect holdBox = {panelX - 10, holdBoxY, 100, 90};
     SDL_RenderFillRect(renderer, &holdBox);
-    SDL_SetRenderDrawColor(renderer, canHold ? (Uint8)60 : (Uint8)40, canHold ? (Uint8)90 : (Uint8)50, canHold ? (Uint8)140 : (Uint8)80, 255);
-    SDL_RenderDrawRect(renderer, &holdBox);
-
-    renderText("HOLD", panelX + 15, holdBoxY + 5, canHold ? SDL_Color{150, 180, 220, 255} : SDL_Color{80, 80, 100, 255});
-
-    if (holdPiece) {
-        auto holdCells = holdPiece->getOccupiedCells();
-        SDL_Color holdColor = pieceColors[holdPiece->getType()];
-        if (!canHold) {
-            holdColor.r /= 2;
-            holdColor.g /= 2;
-            holdColor.b /= 2;
-        }
-        for (const auto& cell : holdCells) {
-            int px = panelX + cell.first * 18 + 8;
-            int py = holdBoxY + cell.second * 18 + 30;
-            renderBlockAt(px, py, 16, holdColor);
-        }
-    }
 
     // ===== NEXT PIECE BOX =====
     int nextBoxY = holdBoxY + 100;
@@ -256,14 +423,7 @@ void Renderer::renderGame(const Board& board, const Tetromino& currentPiece,
     SDL_SetRenderDrawColor(renderer, 60, 90, 140, 255);
     SDL_RenderDrawRect(renderer, &nextBox);
 
-    renderText("NEXT", panelX + 15, nextBoxY + 5, {150, 180, 220, 255});
-
-    auto nextCells = nextPiece.getOccupiedCells();
-    for (const auto& cell : nextCells) {
-        int px = panelX + cell.first * 18 + 8;
-        int py = nextBoxY + cell.second * 18 + 30;
-        renderBlockAt(px, py, 16, pieceColors[nextPiece.getType()]);
-    }
+    renderStaticText("NEXT", panelX + 15, nextBoxY + 5, {150, 180, 220, 255});
 
     // ===== STATS BOX =====
     int statsBoxY = nextBoxY + 105;
@@ -273,21 +433,10 @@ void Renderer::renderGame(const Board& board, const Tetromino& currentPiece,
     SDL_SetRenderDrawColor(renderer, 60, 90, 140, 255);
     SDL_RenderDrawRect(renderer, &statsBox);
 
-    // Score
-    renderText("SCORE", panelX, statsBoxY + 10, {120, 150, 200, 255});
-    renderText(formatNumber(score), panelX + 10, statsBoxY + 30, {255, 240, 100, 255});
-
-    // High Score
-    renderText("BEST", panelX, statsBoxY + 55, {255, 200, 80, 255});
-    renderText(formatNumber(highScore), panelX + 10, statsBoxY + 75, {255, 200, 80, 255});
-
-    // Level
-    renderText("LEVEL", panelX, statsBoxY + 100, {120, 150, 200, 255});
-    renderText(std::to_string(level), panelX + 10, statsBoxY + 120, {100, 255, 180, 255});
-
-    // Lines
-    renderText("LINES", panelX, statsBoxY + 145, {120, 150, 200, 255});
-    renderText(formatNumber(lines), panelX + 10, statsBoxY + 165, {255, 150, 200, 255});
+    renderStaticText("SCORE", panelX, statsBoxY + 10, {120, 150, 200, 255});
+    renderStaticText("BEST", panelX, statsBoxY + 55, {255, 200, 80, 255});
+    renderStaticText("LEVEL", panelX, statsBoxY + 100, {120, 150, 200, 255});
+    renderStaticText("LINES", panelX, statsBoxY + 145, {120, 150, 200, 255});
 
     // ===== CONTROLS BOX (Bottom) =====
     int ctrlBoxY = boardY + boardHeight + 20;
@@ -297,16 +446,43 @@ void Renderer::renderGame(const Board& board, const Tetromino& currentPiece,
     SDL_SetRenderDrawColor(renderer, 50, 70, 110, 255);
     SDL_RenderDrawRect(renderer, &ctrlBox);
 
-    renderText("CONTROLS", boardX + 80, ctrlBoxY + 8, {100, 160, 220, 255});
+    renderStaticText("CONTROLS", boardX + 80, ctrlBoxY + 8, {100, 160, 220, 255});
 
     int ctrlTextY = ctrlBoxY + 30;
     SDL_Color ctrlColor = {160, 170, 190, 255};
-    renderText("A/D   MOVE", boardX + 10, ctrlTextY, ctrlColor);
-    renderText("W     ROTATE", boardX + 10, ctrlTextY + 18, ctrlColor);
-    renderText("S     SOFT DROP", boardX + 10, ctrlTextY + 36, ctrlColor);
-    renderText("SPACE HARD DROP", boardX + 10, ctrlTextY + 54, ctrlColor);
-    renderText("C     HOLD", boardX + 10, ctrlTextY + 72, ctrlColor);
-    renderText("P PAUSE  Q QUIT", boardX + 10, ctrlTextY + 90, {120, 140, 160, 255});
+    renderStaticText("A/D   MOVE", boardX + 10, ctrlTextY, ctrlColor);
+    renderStaticText("W/Z/X ROTATE", boardX + 10, ctrlTextY + 18, ctrlColor);
+    renderStaticText("S     SOFT DROP", boardX + 10, ctrlTextY + 36, ctrlColor);
+    renderStaticText("SPACE HARD DROP", boardX + 10, ctrlTextY + 54, ctrlColor);
+    renderStaticText("C     HOLD", boardX + 10, ctrlTextY + 72, ctrlColor);
+    renderStaticText("P PAUSE  Q QUIT", boardX + 10, ctrlTextY + 90, {120, 140, 160, 255});
+}
+
+void Renderer::drawLockedCells(const Board& board) {
+    // Only the visible rows from the top of the stack down can hold cells
+    const auto& grid = board.getGrid();
+    for (int row = std::max(board.getStackTop(), Board::BUFFER_ROWS); row < board.getHeight(); row++) {
+        if (board.getRow(row) == 0) continue;
+        for (int col = 0; col < board.getWidth(); col++) {
+            if (grid[row][col] != -1) {
+                // Check if this row is being cleared (for animation)
+                bool isClearing = false;
+                for (int clearRow : linesToClear) {
+                    if (row == clearRow) {
+                        isClearing = true;
+                        break;
+                    }
+                }
+
+                if (isClearing && lineClearAnimFrame > 0 && lineClearAnimFrame % 4 < 2) {
+                    // Flash effect during line clear
+                    drawBoardBlock(col, row, BLOCK_FLASH);
+                } else {
+                    drawBoardBlock(col, row, BLOCK_PIECE + grid[row][col]);
+                }
+            }
+        }
+    }
 }
 
 void Renderer::renderPauseScreen() {
@@ -332,13 +508,17 @@ void Renderer::renderPauseScreen() {
     SDL_Rect glow = {boxX - 3, boxY - 3, boxW + 6, boxH + 6};
     SDL_RenderDrawRect(renderer, &glow);
 
-    renderText("PAUSED", boxX + 90, boxY + 30, {100, 180, 255, 255}, 3);
+    renderStaticText("PAUSED", boxX + 90, boxY + 30, {100, 180, 255, 255}, 3);
 
-    renderText("PRESS P TO RESUME", boxX + 55, boxY + 80, {180, 190, 210, 255});
-    renderText("PRESS Q TO QUIT", boxX + 70, boxY + 110, {140, 140, 160, 255});
+    renderStaticText("PRESS P TO RESUME", boxX + 55, boxY + 80, {180, 190, 210, 255});
+    renderStaticText("PRESS Q TO QUIT", boxX + 70, boxY + 110, {140, 140, 160, 255});
 }
 
 void Renderer::renderTitleScreen() {
+    drawLayer(titleLayer, LAYER_TITLE, SDL_BLENDMODE_NONE, [this] { drawTitle(); });
+}
+
+void Renderer::drawTitle() {
     // Background with subtle gradient effect
     for (int y = 0; y < screenHeight; y += 4) {
         int shade = 18 + (y * 10 / screenHeight);
@@ -355,22 +535,23 @@ void Renderer::renderTitleScreen() {
     SDL_Rect titleGlow = {titleX - 30, titleY - 20, 300, 80};
     SDL_RenderFillRect(renderer, &titleGlow);
 
-    renderText("TETRIS", titleX, titleY, {80, 160, 255, 255}, 5);
+    renderStaticText("TETRIS", titleX, titleY, {80, 160, 255, 255}, 5);
 
     // Subtitle
-    renderText("C++ EDITION", titleX + 55, titleY + 70, {100, 120, 160, 255}, 2);
+    renderStaticText("C++ EDITION", titleX + 55, titleY + 70, {100, 120, 160, 255}, 2);
 
     // Decorative tetrominoes
     int demoY = 320;
     for (int i = 0; i < 7; i++) {
         int px = 200 + i * 90;
-        renderBlockAt(px, demoY, 24, pieceColors[i]);
-        renderBlockAt(px + 26, demoY, 24, pieceColors[i]);
+        drawBlock(px, demoY, TITLE_BLOCK_SIZE, BLOCK_PIECE + i);
+        drawBlock(px + 26, demoY, TITLE_BLOCK_SIZE, BLOCK_PIECE + i);
     }
+    flushBlocks();
 
     // Instructions
     int instY = 420;
-    renderText("PRESS ENTER TO START", screenWidth / 2 - 130, instY, {180, 200, 230, 255}, 2);
+    renderStaticText("PRESS ENTER TO START", screenWidth / 2 - 130, instY, {180, 200, 230, 255}, 2);
 
     // Controls preview
     int ctrlY = 500;
@@ -380,12 +561,12 @@ void Renderer::renderTitleScreen() {
     SDL_SetRenderDrawColor(renderer, 50, 70, 110, 255);
     SDL_RenderDrawRect(renderer, &ctrlBox);
 
-    renderText("CONTROLS", screenWidth / 2 - 50, ctrlY + 15, {100, 160, 220, 255});
+    renderStaticText("CONTROLS", screenWidth / 2 - 50, ctrlY + 15, {100, 160, 220, 255});
 
     SDL_Color ctrlColor = {140, 150, 170, 255};
-    renderText("A/D - MOVE   W - ROTATE", screenWidth / 2 - 140, ctrlY + 45, ctrlColor);
-    renderText("S - SOFT DROP   SPACE - HARD DROP", screenWidth / 2 - 180, ctrlY + 70, ctrlColor);
-    renderText("C - HOLD   P - PAUSE   Q - QUIT", screenWidth / 2 - 170, ctrlY + 95, ctrlColor);
+    renderStaticText("A/D - MOVE   W/Z/X - ROTATE", screenWidth / 2 - 160, ctrlY + 45, ctrlColor);
+    renderStaticText("S - SOFT DROP   SPACE - HARD DROP", screenWidth / 2 - 180, ctrlY + 70, ctrlColor);
+    renderStaticText("C - HOLD   P - PAUSE   Q - QUIT", screenWidth / 2 - 170, ctrlY + 95, ctrlColor);
 }
 
 void Renderer::renderGameOver(int score, int highScore, int level, int lines) {
@@ -414,7 +595,7 @@ void Renderer::renderGameOver(int score, int highScore, int level, int lines) {
     SDL_RenderDrawRect(renderer, &gameOverBox);
 
     // Game Over text
-    renderText("GAME OVER", boxX + 130, boxY + 30, {255, 80, 80, 255}, 3);
+    renderStaticText("GAME OVER", boxX + 130, boxY + 30, {255, 80, 80, 255}, 3);
 
     // Separator
     SDL_SetRenderDrawColor(renderer, 120, 60, 60, 255);
@@ -424,24 +605,24 @@ void Renderer::renderGameOver(int score, int highScore, int level, int lines) {
     int textY = boxY + 95;
 
     if (isNewHighScore) {
-        renderText("NEW HIGH SCORE!", boxX + 140, textY, {255, 220, 80, 255}, 2);
+        renderStaticText("NEW HIGH SCORE!", boxX + 140, textY, {255, 220, 80, 255}, 2);
         textY += 40;
     }
 
     // Stats
-    renderText("FINAL SCORE", boxX + 170, textY, {180, 200, 230, 255});
+    renderStaticText("FINAL SCORE", boxX + 170, textY, {180, 200, 230, 255});
     renderText(formatNumber(score), boxX + 200, textY + 25, {255, 240, 100, 255}, 2);
 
     textY += 65;
-    renderText("BEST SCORE", boxX + 175, textY, {255, 200, 80, 255});
+    renderStaticText("BEST SCORE", boxX + 175, textY, {255, 200, 80, 255});
     renderText(formatNumber(highScore), boxX + 200, textY + 25, {255, 200, 80, 255}, 2);
 
     textY += 65;
-    renderText("LEVEL", boxX + 210, textY, {150, 200, 255, 255});
+    renderStaticText("LEVEL", boxX + 210, textY, {150, 200, 255, 255});
     renderText(std::to_string(level), boxX + 235, textY + 25, {100, 255, 180, 255}, 2);
 
     textY += 65;
-    renderText("LINES CLEARED", boxX + 160, textY, {255, 150, 200, 255});
+    renderStaticText("LINES CLEARED", boxX + 160, textY, {255, 150, 200, 255});
     renderText(formatNumber(lines), boxX + 220, textY + 25, {255, 150, 200, 255}, 2);
 
     // Actions
@@ -449,8 +630,9 @@ void Renderer::renderGameOver(int score, int highScore, int level, int lines) {
     SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
     SDL_RenderDrawLine(renderer, boxX + 50, actionY - 15, boxX + boxW - 50, actionY - 15);
 
-    renderText("R - RETRY", boxX + 120, actionY, {100, 255, 120, 255});
-    renderText("Q - QUIT", boxX + 290, actionY, {255, 100, 100, 255});
+    renderStaticText("R - RETRY", boxX + 120, actionY, {100, 255, 120, 255});
+    renderStaticText("Q - QUIT", boxX + 290, actionY, {255, 100, 100, 255});
+    font.flush();
 }
 
 void Renderer::startLineClearAnimation(const std::vector<int>& lines) {
@@ -483,167 +665,67 @@ std::string Renderer::formatNumber(int number) {
 }
 
 void Renderer::renderText(const std::string& text, int x, int y, SDL_Color color, int scale) {
-    const int charWidth = 6;
-    const int pixelSize = scale;
-
-    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-
-    int cursorX = x;
-
-    for (char c : text) {
-        std::vector<std::vector<int>> pattern;
-
-        switch (toupper(c)) {
-            case 'A':
-                pattern = {{0,1,1,1,0}, {1,0,0,0,1}, {1,1,1,1,1}, {1,0,0,0,1}, {1,0,0,0,1}};
-                break;
-            case 'B':
-                pattern = {{1,1,1,1,0}, {1,0,0,0,1}, {1,1,1,1,0}, {1,0,0,0,1}, {1,1,1,1,0}};
-                break;
-            case 'C':
-                pattern = {{0,1,1,1,0}, {1,0,0,0,0}, {1,0,0,0,0}, {1,0,0,0,0}, {0,1,1,1,0}};
-                break;
-            case 'D':
-                pattern = {{1,1,1,0,0}, {1,0,0,1,0}, {1,0,0,0,1}, {1,0,0,1,0}, {1,1,1,0,0}};
-                break;
-            case 'E':
-                pattern = {{1,1,1,1,1}, {1,0,0,0,0}, {1,1,1,1,0}, {1,0,0,0,0}, {1,1,1,1,1}};
-                break;
-            case 'F':
-                pattern = {{1,1,1,1,1}, {1,0,0,0,0}, {1,1,1,1,0}, {1,0,0,0,0}, {1,0,0,0,0}};
-                break;
-            case 'G':
-                pattern = {{0,1,1,1,0}, {1,0,0,0,0}, {1,0,1,1,1}, {1,0,0,0,1}, {0,1,1,1,0}};
-                break;
-            case 'H':
-                pattern = {{1,0,0,0,1}, {1,0,0,0,1}, {1,1,1,1,1}, {1,0,0,0,1}, {1,0,0,0,1}};
-                break;
-            case 'I':
-                pattern = {{1,1,1,1,1}, {0,0,1,0,0}, {0,0,1,0,0}, {0,0,1,0,0}, {1,1,1,1,1}};
-                break;
-            case 'J':
-                pattern = {{0,0,1,1,1}, {0,0,0,1,0}, {0,0,0,1,0}, {1,0,0,1,0}, {0,1,1,0,0}};
-                break;
-            case 'K':
-                pattern = {{1,0,0,1,0}, {1,0,1,0,0}, {1,1,0,0,0}, {1,0,1,0,0}, {1,0,0,1,0}};
-                break;
-            case 'L':
-                pattern = {{1,0,0,0,0}, {1,0,0,0,0}, {1,0,0,0,0}, {1,0,0,0,0}, {1,1,1,1,1}};
-                break;
-            case 'M':
-                pattern = {{1,0,0,0,1}, {1,1,0,1,1}, {1,0,1,0,1}, {1,0,0,0,1}, {1,0,0,0,1}};
-                break;
-            case 'N':
-                pattern = {{1,0,0,0,1}, {1,1,0,0,1}, {1,0,1,0,1}, {1,0,0,1,1}, {1,0,0,0,1}};
-                break;
-            case 'O':
-                pattern = {{0,1,1,1,0}, {1,0,0,0,1}, {1,0,0,0,1}, {1,0,0,0,1}, {0,1,1,1,0}};
-                break;
-            case 'P':
-                pattern = {{1,1,1,1,0}, {1,0,0,0,1}, {1,1,1,1,0}, {1,0,0,0,0}, {1,0,0,0,0}};
-                break;
-            case 'Q':
-                pattern = {{0,1,1,1,0}, {1,0,0,0,1}, {1,0,0,0,1}, {1,0,0,1,0}, {0,1,1,0,1}};
-                break;
-            case 'R':
-                pattern = {{1,1,1,1,0}, {1,0,0,0,1}, {1,1,1,1,0}, {1,0,1,0,0}, {1,0,0,1,0}};
-                break;
-            case 'S':
-                pattern = {{0,1,1,1,1}, {1,0,0,0,0}, {0,1,1,1,0}, {0,0,0,0,1}, {1,1,1,1,0}};
-                break;
-            case 'T':
-                pattern = {{1,1,1,1,1}, {0,0,1,0,0}, {0,0,1,0,0}, {0,0,1,0,0}, {0,0,1,0,0}};
-                break;
-            case 'U':
-                pattern = {{1,0,0,0,1}, {1,0,0,0,1}, {1,0,0,0,1}, {1,0,0,0,1}, {0,1,1,1,0}};
-                break;
-            case 'V':
-                pattern = {{1,0,0,0,1}, {1,0,0,0,1}, {1,0,0,0,1}, {0,1,0,1,0}, {0,0,1,0,0}};
-                break;
-            case 'W':
-                pattern = {{1,0,0,0,1}, {1,0,0,0,1}, {1,0,1,0,1}, {1,1,0,1,1}, {1,0,0,0,1}};
-                break;
-            case 'X':
-                pattern = {{1,0,0,0,1}, {0,1,0,1,0}, {0,0,1,0,0}, {0,1,0,1,0}, {1,0,0,0,1}};
-                break;
-            case 'Y':
-                pattern = {{1,0,0,0,1}, {0,1,0,1,0}, {0,0,1,0,0}, {0,0,1,0,0}, {0,0,1,0,0}};
-                break;
-            case 'Z':
-                pattern = {{1,1,1,1,1}, {0,0,0,1,0}, {0,0,1,0,0}, {0,1,0,0,0}, {1,1,1,1,1}};
-                break;
-            case '0':
-                pattern = {{0,1,1,1,0}, {1,0,0,1,1}, {1,0,1,0,1}, {1,1,0,0,1}, {0,1,1,1,0}};
-                break;
-            case '1':
-                pattern = {{0,0,1,0,0}, {0,1,1,0,0}, {0,0,1,0,0}, {0,0,1,0,0}, {0,1,1,1,0}};
-                break;
-            case '2':
-                pattern = {{0,1,1,1,0}, {1,0,0,0,1}, {0,0,1,1,0}, {0,1,0,0,0}, {1,1,1,1,1}};
-                break;
-            case '3':
-                pattern = {{1,1,1,1,0}, {0,0,0,0,1}, {0,1,1,1,0}, {0,0,0,0,1}, {1,1,1,1,0}};
-                break;
-            case '4':
-                pattern = {{1,0,0,1,0}, {1,0,0,1,0}, {1,1,1,1,1}, {0,0,0,1,0}, {0,0,0,1,0}};
-                break;
-            case '5':
-                pattern = {{1,1,1,1,1}, {1,0,0,0,0}, {1,1,1,1,0}, {0,0,0,0,1}, {1,1,1,1,0}};
-                break;
-            case '6':
-                pattern = {{0,1,1,1,0}, {1,0,0,0,0}, {1,1,1,1,0}, {1,0,0,0,1}, {0,1,1,1,0}};
-                break;
-            case '7':
-                pattern = {{1,1,1,1,1}, {0,0,0,1,0}, {0,0,1,0,0}, {0,1,0,0,0}, {1,0,0,0,0}};
-                break;
-            case '8':
-                pattern = {{0,1,1,1,0}, {1,0,0,0,1}, {0,1,1,1,0}, {1,0,0,0,1}, {0,1,1,1,0}};
-                break;
-            case '9':
-                pattern = {{0,1,1,1,0}, {1,0,0,0,1}, {0,1,1,1,1}, {0,0,0,0,1}, {0,1,1,1,0}};
-                break;
-            case ':':
-                pattern = {{0,0,0,0,0}, {0,0,1,0,0}, {0,0,0,0,0}, {0,0,1,0,0}, {0,0,0,0,0}};
-                break;
-            case '!':
-                pattern = {{0,0,1,0,0}, {0,0,1,0,0}, {0,0,1,0,0}, {0,0,0,0,0}, {0,0,1,0,0}};
-                break;
-            case '/':
-                pattern = {{0,0,0,0,1}, {0,0,0,1,0}, {0,0,1,0,0}, {0,1,0,0,0}, {1,0,0,0,0}};
-                break;
-            case '-':
-                pattern = {{0,0,0,0,0}, {0,0,0,0,0}, {1,1,1,1,1}, {0,0,0,0,0}, {0,0,0,0,0}};
-                break;
-            case ',':
-                pattern = {{0,0,0,0,0}, {0,0,0,0,0}, {0,0,0,0,0}, {0,0,1,0,0}, {0,1,0,0,0}};
-                break;
-            case '.':
-                pattern = {{0,0,0,0,0}, {0,0,0,0,0}, {0,0,0,0,0}, {0,0,0,0,0}, {0,0,1,0,0}};
-                break;
-            case ' ':
-                pattern = {{0,0,0,0,0}, {0,0,0,0,0}, {0,0,0,0,0}, {0,0,0,0,0}, {0,0,0,0,0}};
-                break;
-            default:
-                pattern = {{0,1,1,1,0}, {1,0,0,0,1}, {1,0,0,0,1}, {1,0,0,0,1}, {0,1,1,1,0}};
-                break;
-        }
+    font.drawText(text, x, y, color, scale);
+}
 
-        // Draw the character pattern
-        for (int row = 0; row < 5; row++) {
-            for (int col = 0; col < 5; col++) {
-                if (pattern[row][col]) {
-                    SDL_Rect pixel = {cursorX + col * pixelSize, y + row * pixelSize, pixelSize, pixelSize};
-                    SDL_RenderFillRect(renderer, &pixel);
-                }
-            }
+void Renderer::renderStaticText(const std::string& text, int x, int y, SDL_Color color, int scale) {
+    font.drawStaticText(text, x, y, color, scale);
+}
+
+void Renderer::present() {
+    flushBlocks();
+    font.flush();
+    SDL_RenderPresent(renderer);
+    dirtyLayers = 0;
+}
+
+template <typename DrawFn>
+void Renderer::drawLayer(SDL_Texture*& texture, uint8_t layer, SDL_BlendMode blendMode, DrawFn draw) {
+    if (!texture && retainedLayers) {
+        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                    screenWidth, screenHeight);
+        if (!texture) {
+            // Keep drawing every layer directly from now on
+            std::cerr << "Layer texture creation failed: " << SDL_GetError() << std::endl;
+            retainedLayers = false;
+        } else {
+            SDL_SetTextureBlendMode(texture, blendMode);
+            dirtyLayers |= layer;
         }
+    }
+
+    if (!texture) {
+        draw();
+        return;
+    }
 
-        cursorX += charWidth * pixelSize;
+    if (dirtyLayers & layer) {
+        flushBlocks();
+        font.flush();
+        SDL_SetRenderTarget(renderer, texture);
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        SDL_RenderClear(renderer);
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+        draw();
+        flushBlocks();
+        font.flush();
+        SDL_SetRenderTarget(renderer, nullptr);
     }
+
+    SDL_RenderCopy(renderer, texture, nullptr, nullptr);
 }
 
-void Renderer::present() {
-    SDL_RenderPresent(renderer);
+void Renderer::destroyLayers() {
+    SDL_Texture** layers[] = {&chromeLayer, &boardLayer, &titleLayer};
+    for (SDL_Texture** layer : layers) {
+        if (*layer) {
+            SDL_DestroyTexture(*layer);
+            *layer = nullptr;
+        }
+    }
+    dirtyLayers = LAYER_ALL;
 }
 
 bool Renderer::isRunning() const {
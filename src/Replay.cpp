@@ -0,0 +1,197 @@
+#include "Replay.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+const char MAGIC[4] = {'T', 'R', 'P', 'L'};
+const uint8_t END_MARKER = 0xFF;
+const size_t HEADER_SIZE = 4 + 1 + 8 + 1 + 2 + 2 + 1;
+
+void putVarint(std::vector<uint8_t>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+bool getVarint(const std::vector<uint8_t>& in, size_t& pos, uint32_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 35 && pos < in.size(); shift += 7) {
+        uint8_t byte = in[pos++];
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+void putLittleEndian(std::vector<uint8_t>& out, uint64_t value, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+uint64_t getLittleEndian(const std::vector<uint8_t>& in, size_t pos, int bytes) {
+    uint64_t value = 0;
+    for (int i = 0; i < bytes; i++) {
+        value |= static_cast<uint64_t>(in[pos + i]) << (8 * i);
+    }
+    return value;
+}
+
+}  // namespace
+
+Replay::Replay()
+    : seed(0), mode(GeneratorMode::UNIFORM), lineClearDelay(0),
+      lockDelay(GameCore::DEFAULT_LOCK_DELAY), maxLockResets(GameCore::DEFAULT_LOCK_RESETS),
+      tickCount(0) {}
+
+void Replay::begin(const GameCore& core) {
+    seed = core.getGenerator().getSeed();
+    mode = core.getGenerator().getMode();
+    lineClearDelay = core.getLineClearDelay();
+    lockDelay = core.getLockDelay();
+    maxLockResets = core.getMaxLockResets();
+    tickCount = 0;
+    events.clear();
+}
+
+void Replay::record(uint32_t tick, InputAction action) {
+    events.push_back({tick, action});
+    tickCount = tick;
+}
+
+void Replay::setupCore(GameCore& core) const {
+    core.getGenerator().setMode(mode);
+    core.setLineClearDelay(lineClearDelay);
+    core.setLockDelay(lockDelay);
+    core.setMaxLockResets(maxLockResets);
+    core.reset(seed);
+}
+
+std::vector<uint8_t> Replay::encode() const {
+    std::vector<uint8_t> out(MAGIC, MAGIC + 4);
+    out.reserve(HEADER_SIZE + events.size() * 2 + 4);
+    out.push_back(VERSION);
+    putLittleEndian(out, seed, 8);
+    out.push_back(static_cast<uint8_t>(mode));
+    putLittleEndian(out, static_cast<uint64_t>(lineClearDelay), 2);
+    putLittleEndian(out, static_cast<uint64_t>(lockDelay), 2);
+    out.push_back(static_cast<uint8_t>(maxLockResets));
+
+    uint32_t previous = 0;
+    for (const ReplayEvent& event : events) {
+        putVarint(out, event.tick - previous);
+        out.push_back(static_cast<uint8_t>(event.action));
+        previous = event.tick;
+    }
+    putVarint(out, tickCount - previous);
+    out.push_back(END_MARKER);
+    return out;
+}
+
+bool Replay::decode(const std::vector<uint8_t>& bytes) {
+    if (bytes.size() < HEADER_SIZE || !std::equal(MAGIC, MAGIC + 4, bytes.begin()) ||
+        bytes[4] != VERSION) {
+        return false;
+    }
+
+    uint64_t newSeed = getLittleEndian(bytes, 5, 8);
+    uint8_t newMode = bytes[13];
+    if (newMode > static_cast<uint8_t>(GeneratorMode::SEVEN_BAG)) return false;
+    int newDelay = static_cast<int>(getLittleEndian(bytes, 14, 2));
+    int newLockDelay = static_cast<int>(getLittleEndian(bytes, 16, 2));
+    int newLockResets = bytes[18];
+
+    std::vector<ReplayEvent> newEvents;
+    newEvents.reserve((bytes.size() - HEADER_SIZE) / 2);
+    size_t pos = HEADER_SIZE;
+    uint32_t tick = 0;
+    while (true) {
+        uint32_t delta;
+        if (!getVarint(bytes, pos, delta) || pos >= bytes.size()) return false;
+        tick += delta;
+
+        uint8_t action = bytes[pos++];
+        if (action == END_MARKER) break;
+        if (action > static_cast<uint8_t>(InputAction::ROTATE_180)) return false;
+        newEvents.push_back({tick, static_cast<InputAction>(action)});
+    }
+
+    seed = newSeed;
+    mode = static_cast<GeneratorMode>(newMode);
+    lineClearDelay = newDelay;
+    lockDelay = newLockDelay;
+    maxLockResets = newLockResets;
+    tickCount = tick;
+    events.swap(newEvents);
+    return true;
+}
+
+bool Replay::save(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    std::vector<uint8_t> bytes = encode();
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(file);
+}
+
+bool Replay::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return decode(bytes);
+}
+
+ReplayPlayer::ReplayPlayer(const Replay& replay, uint32_t snapshotInterval)
+    : replay(replay), snapshotInterval(snapshotInterval > 0 ? snapshotInterval : 1), nextEvent(0) {
+    restart();
+}
+
+bool ReplayPlayer::atEnd() const {
+    return core.getTickCount() >= replay.getTickCount() || core.isGameOver();
+}
+
+void ReplayPlayer::restart() {
+    replay.setupCore(core);
+    nextEvent = 0;
+    snapshots.clear();
+    step();
+}
+
+void ReplayPlayer::step() {
+    // Inputs stamped with this tick happen before the next one runs
+    const std::vector<ReplayEvent>& events = replay.getEvents();
+    while (nextEvent < events.size() && events[nextEvent].tick <= core.getTickCount()) {
+        core.applyAction(events[nextEvent].action);
+        nextEvent++;
+    }
+
+    uint32_t tick = core.getTickCount();
+    if (tick % snapshotInterval == 0 && tick / snapshotInterval == snapshots.size()) {
+        snapshots.emplace_back();
+        core.snapshot(snapshots.back().state);
+        snapshots.back().nextEvent = nextEvent;
+    }
+}
+
+void ReplayPlayer::seek(uint32_t tick) {
+    if (tick > replay.getTickCount()) tick = replay.getTickCount();
+
+    // Jump to the closest snapshot at or before the target when it helps
+    size_t index = std::min<size_t>(tick / snapshotInterval, snapshots.size() - 1);
+    uint32_t snapshotTick = static_cast<uint32_t>(index) * snapshotInterval;
+    if (tick < core.getTickCount() || snapshotTick > core.getTickCount()) {
+        core.restore(snapshots[index].state);
+        nextEvent = snapshots[index].nextEvent;
+    }
+
+    while (core.getTickCount() < tick && !core.isGameOver()) {
+        core.tick();
+        step();
+    }
+}
@@ -0,0 +1,91 @@
+#include "Simulator.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+// Derive an independent seed for each game from the run seed
+static uint64_t gameSeed(uint64_t seed, uint64_t game) {
+    uint64_t z = seed + (game + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+Simulator::Simulator(const SimConfig& config) : config(config) {}
+
+void Simulator::playGame(GameCore& core, MovePolicy& policy, int maxPieces) {
+    std::vector<InputAction> actions;
+    actions.reserve(32);
+
+    while (!core.isGameOver() && core.getPiecesPlaced() < maxPieces) {
+        int placed = core.getPiecesPlaced();
+        policy.chooseActions(core, actions);
+        for (InputAction action : actions) {
+            core.applyAction(action);
+        }
+
+        // Hard drops lock at once; anything else waits out the lock delay
+        while (!core.isGameOver() && core.getPiecesPlaced() == placed) {
+            core.tick();
+        }
+    }
+}
+
+SimStats Simulator::run() {
+    ThreadPool pool(config.threads);
+
+    // One table for every game: results depend only on the position searched
+    std::unique_ptr<TranspositionTable> cache;
+    if (config.cacheBits > 0) {
+        cache = std::make_unique<TranspositionTable>(config.cacheBits);
+    }
+
+    std::atomic<uint64_t> pieces(0), lines(0), totalScore(0);
+    std::atomic<int> bestScore(0);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int first = 0; first < config.games; first += config.gamesPerTask) {
+        int last = std::min(config.games, first + config.gamesPerTask);
+
+        pool.submit([&, first, last] {
+            uint64_t batchPieces = 0, batchLines = 0, batchScore = 0;
+            int batchBest = 0;
+
+            GameCore core(0, config.mode);
+            for (int game = first; game < last; game++) {
+                uint64_t seed = gameSeed(config.seed, static_cast<uint64_t>(game));
+                auto policy = MovePolicy::create(config.policy, seed, config.lookahead, cache.get());
+
+                core.reset(seed);
+                playGame(core, *policy, config.maxPieces);
+
+                batchPieces += core.getPiecesPlaced();
+                batchLines += core.getLines();
+                batchScore += core.getScore();
+                batchBest = std::max(batchBest, core.getScore());
+            }
+
+            pieces += batchPieces;
+            lines += batchLines;
+            totalScore += batchScore;
+            int best = bestScore.load();
+            while (batchBest > best && !bestScore.compare_exchange_weak(best, batchBest)) {}
+        });
+    }
+    pool.wait();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    SimStats stats;
+    stats.games = static_cast<uint64_t>(config.games);
+    stats.pieces = pieces;
+    stats.lines = lines;
+    stats.totalScore = totalScore;
+    stats.bestScore = bestScore;
+    stats.threads = pool.getThreadCount();
+    stats.seconds = elapsed.count();
+    return stats;
+}
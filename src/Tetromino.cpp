@@ -1,14 +1,14 @@
 #include "Tetromino.h"
 
-// Define all tetromino shapes with 4 rotation states
-// Each shape is a 4x4 grid
-const bool Tetromino::shapes[7][4][4][4] = {
+// Define all tetromino shapes with 4 rotation states (SRS: spawn, right,
+// 180, left). I and O turn in a 4x4 box, the others in the top-left 3x3
+constexpr bool Tetromino::shapes[7][4][4][4] = {
     // I-piece (light blue)
     {
         { {0, 0, 0, 0}, {1, 1, 1, 1}, {0, 0, 0, 0}, {0, 0, 0, 0} },
         { {0, 0, 1, 0}, {0, 0, 1, 0}, {0, 0, 1, 0}, {0, 0, 1, 0} },
-        { {0, 0, 0, 0}, {1, 1, 1, 1}, {0, 0, 0, 0}, {0, 0, 0, 0} },
-        { {0, 0, 1, 0}, {0, 0, 1, 0}, {0, 0, 1, 0}, {0, 0, 1, 0} }
+        { {0, 0, 0, 0}, {0, 0, 0, 0}, {1, 1, 1, 1}, {0, 0, 0, 0} },
+        { {0, 1, 0, 0}, {0, 1, 0, 0}, {0, 1, 0, 0}, {0, 1, 0, 0} }
     },
     // O-piece (yellow)
     {
@@ -28,32 +28,100 @@ const bool Tetromino::shapes[7][4][4][4] = {
     {
         { {0, 1, 1, 0}, {1, 1, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0} },
         { {0, 1, 0, 0}, {0, 1, 1, 0}, {0, 0, 1, 0}, {0, 0, 0, 0} },
-        { {0, 1, 1, 0}, {1, 1, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0} },
-        { {0, 1, 0, 0}, {0, 1, 1, 0}, {0, 0, 1, 0}, {0, 0, 0, 0} }
+        { {0, 0, 0, 0}, {0, 1, 1, 0}, {1, 1, 0, 0}, {0, 0, 0, 0} },
+        { {1, 0, 0, 0}, {1, 1, 0, 0}, {0, 1, 0, 0}, {0, 0, 0, 0} }
     },
     // Z-piece (red)
     {
         { {1, 1, 0, 0}, {0, 1, 1, 0}, {0, 0, 0, 0}, {0, 0, 0, 0} },
         { {0, 0, 1, 0}, {0, 1, 1, 0}, {0, 1, 0, 0}, {0, 0, 0, 0} },
-        { {1, 1, 0, 0}, {0, 1, 1, 0}, {0, 0, 0, 0}, {0, 0, 0, 0} },
-        { {0, 0, 1, 0}, {0, 1, 1, 0}, {0, 1, 0, 0}, {0, 0, 0, 0} }
+        { {0, 0, 0, 0}, {1, 1, 0, 0}, {0, 1, 1, 0}, {0, 0, 0, 0} },
+        { {0, 1, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0, 0, 0, 0} }
     },
     // J-piece (blue)
     {
-        { {0, 1, 0, 0}, {0, 1, 0, 0}, {1, 1, 0, 0}, {0, 0, 0, 0} },
         { {1, 0, 0, 0}, {1, 1, 1, 0}, {0, 0, 0, 0}, {0, 0, 0, 0} },
-        { {1, 1, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0, 0, 0, 0} },
-        { {1, 1, 1, 0}, {0, 0, 1, 0}, {0, 0, 0, 0}, {0, 0, 0, 0} }
+        { {0, 1, 1, 0}, {0, 1, 0, 0}, {0, 1, 0, 0}, {0, 0, 0, 0} },
+        { {0, 0, 0, 0}, {1, 1, 1, 0}, {0, 0, 1, 0}, {0, 0, 0, 0} },
+        { {0, 1, 0, 0}, {0, 1, 0, 0}, {1, 1, 0, 0}, {0, 0, 0, 0} }
     },
     // L-piece (orange)
     {
-        { {1, 0, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0, 0, 0, 0} },
-        { {1, 1, 1, 0}, {1, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0} },
-        { {1, 1, 0, 0}, {0, 1, 0, 0}, {0, 1, 0, 0}, {0, 0, 0, 0} },
-        { {0, 0, 1, 0}, {1, 1, 1, 0}, {0, 0, 0, 0}, {0, 0, 0, 0} }
+        { {0, 0, 1, 0}, {1, 1, 1, 0}, {0, 0, 0, 0}, {0, 0, 0, 0} },
+        { {0, 1, 0, 0}, {0, 1, 0, 0}, {0, 1, 1, 0}, {0, 0, 0, 0} },
+        { {0, 0, 0, 0}, {1, 1, 1, 0}, {1, 0, 0, 0}, {0, 0, 0, 0} },
+        { {1, 1, 0, 0}, {0, 1, 0, 0}, {0, 1, 0, 0}, {0, 0, 0, 0} }
     }
 };
 
+// SRS kick offsets as published (x right, y up), [from rotation][test].
+// Quarter turns use the standard tables; 180 turns use the common SRS+ set
+constexpr int8_t jlstzClockwise[4][5][2] = {
+    {{0, 0}, {-1, 0}, {-1, 1}, {0, -2}, {-1, -2}},  // 0 -> R
+    {{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}},      // R -> 2
+    {{0, 0}, {1, 0}, {1, 1}, {0, -2}, {1, -2}},     // 2 -> L
+    {{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}},   // L -> 0
+};
+constexpr int8_t jlstzCounterClockwise[4][5][2] = {
+    {{0, 0}, {1, 0}, {1, 1}, {0, -2}, {1, -2}},     // 0 -> L
+    {{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}},      // R -> 0
+    {{0, 0}, {-1, 0}, {-1, 1}, {0, -2}, {-1, -2}},  // 2 -> R
+    {{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}},   // L -> 2
+};
+constexpr int8_t iClockwise[4][5][2] = {
+    {{0, 0}, {-2, 0}, {1, 0}, {-2, -1}, {1, 2}},    // 0 -> R
+    {{0, 0}, {-1, 0}, {2, 0}, {-1, 2}, {2, -1}},    // R -> 2
+    {{0, 0}, {2, 0}, {-1, 0}, {2, 1}, {-1, -2}},    // 2 -> L
+    {{0, 0}, {1, 0}, {-2, 0}, {1, -2}, {-2, 1}},    // L -> 0
+};
+constexpr int8_t iCounterClockwise[4][5][2] = {
+    {{0, 0}, {-1, 0}, {2, 0}, {-1, 2}, {2, -1}},    // 0 -> L
+    {{0, 0}, {2, 0}, {-1, 0}, {2, 1}, {-1, -2}},    // R -> 0
+    {{0, 0}, {1, 0}, {-2, 0}, {1, -2}, {-2, 1}},    // 2 -> R
+    {{0, 0}, {-2, 0}, {1, 0}, {-2, -1}, {1, 2}},    // L -> 2
+};
+constexpr int8_t halfTurn[4][6][2] = {
+    {{0, 0}, {0, 1}, {1, 1}, {-1, 1}, {1, 0}, {-1, 0}},     // 0 -> 2
+    {{0, 0}, {1, 0}, {1, 2}, {1, 1}, {0, 2}, {0, 1}},       // R -> L
+    {{0, 0}, {0, -1}, {-1, -1}, {1, -1}, {-1, 0}, {1, 0}},  // 2 -> 0
+    {{0, 0}, {-1, 0}, {-1, 2}, {-1, 1}, {0, 2}, {0, 1}},    // L -> R
+};
+
+// Copy published offsets into a kick list, flipping y to board rows (down)
+template <int N>
+constexpr KickList toKickList(const int8_t (&tests)[N][2]) {
+    KickList list{};
+    list.count = N;
+    for (int i = 0; i < N; i++) {
+        list.offsets[i][0] = tests[i][0];
+        list.offsets[i][1] = static_cast<int8_t>(-tests[i][1]);
+    }
+    return list;
+}
+
+constexpr KickTable buildKicks() {
+    KickTable table{};
+    for (int type = 0; type < 7; type++) {
+        for (int from = 0; from < 4; from++) {
+            if (type == O) {
+                // O looks the same every way round and never kicks
+                for (auto& list : table[type][from]) {
+                    list.count = 1;
+                }
+                continue;
+            }
+            bool isI = type == I;
+            table[type][from][0] = toKickList(isI ? iClockwise[from] : jlstzClockwise[from]);
+            table[type][from][1] = toKickList(halfTurn[from]);
+            table[type][from][2] = toKickList(isI ? iCounterClockwise[from] : jlstzCounterClockwise[from]);
+        }
+    }
+    return table;
+}
+
+constexpr PieceMaskTable Tetromino::masks = buildPieceMasks(Tetromino::shapes);
+constexpr KickTable Tetromino::kicks = buildKicks();
+
 Tetromino::Tetromino(TetrominoType type, int startX, int startY)
     : type(type), x(startX), y(startY), rotation(0) {}
 
@@ -74,7 +142,7 @@ void Tetromino::moveUp() {
 }
 
 void Tetromino::rotate() {
-    rotation = (rotation + 1) % 4;
+    rotateClockwise();
 }
 
 void Tetromino::rotateClockwise() {
@@ -85,6 +153,10 @@ void Tetromino::rotateCounterClockwise() {
     rotation = (rotation + 3) % 4;
 }
 
+void Tetromino::rotate180() {
+    rotation = (rotation + 2) % 4;
+}
+
 TetrominoType Tetromino::getType() const {
     return type;
 }
@@ -110,16 +182,12 @@ void Tetromino::setPosition(int newX, int newY) {
     y = newY;
 }
 
-std::vector<std::pair<int, int>> Tetromino::getOccupiedCells() const {
-    std::vector<std::pair<int, int>> cells;
-    const bool (*shape)[4][4] = getShape();
-    
-    for (int row = 0; row < 4; row++) {
-        for (int col = 0; col < 4; col++) {
-            if ((*shape)[row][col]) {
-                cells.push_back({x + col, y + row});
-            }
-        }
+Tetromino::Cells Tetromino::getOccupiedCells() const {
+    const PieceMask& mask = getMask();
+    Cells cells;
+
+    for (int i = 0; i < 4; i++) {
+        cells[i] = {x + mask.cells[i][0], y + mask.cells[i][1]};
     }
     return cells;
 }
@@ -0,0 +1,154 @@
+#include "ThreadPool.h"
+
+// Pool and worker index running on this thread (nullptr / -1 outside any
+// pool); a task submitting to another pool must not use its own index there
+static thread_local const ThreadPool* currentPool = nullptr;
+static thread_local int currentWorker = -1;
+
+ThreadPool::ThreadPool(int threadCount)
+    : queuedTasks(0), pendingTasks(0), nextQueue(0), stopping(false), rangeFunction(nullptr),
+      rangeContext(nullptr), rangeCount(0), rangeGeneration(0), rangesLeft(0) {
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) threadCount = 1;
+    }
+
+    for (int i = 0; i < threadCount; i++) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (int i = 0; i < threadCount; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(Task task) {
+    int index = currentPool == this ? currentWorker : -1;
+    if (index < 0) {
+        index = static_cast<int>(nextQueue++ % queues.size());
+    }
+
+    pendingTasks++;
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_front(std::move(task));
+    }
+    {
+        // Publish under the state lock so a worker cannot miss the wakeup
+        std::lock_guard<std::mutex> lock(stateMutex);
+        queuedTasks++;
+    }
+    workAvailable.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(stateMutex);
+    allDone.wait(lock, [this] { return pendingTasks.load() == 0; });
+}
+
+void ThreadPool::runRanges(int count, RangeFunction function, const void* context) {
+    if (count <= 0) return;
+
+    // A worker waiting on its own pool would wait for itself
+    if (currentPool == this) {
+        function(context, 0, count);
+        return;
+    }
+
+    std::lock_guard<std::mutex> serial(rangeMutex);
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        rangeFunction = function;
+        rangeContext = context;
+        rangeCount = count;
+        rangesLeft = getThreadCount();
+        rangeGeneration++;
+    }
+    workAvailable.notify_all();
+
+    std::unique_lock<std::mutex> lock(stateMutex);
+    allDone.wait(lock, [this] { return rangesLeft == 0; });
+}
+
+void ThreadPool::runRange(int index) {
+    int threads = getThreadCount();
+    int begin = static_cast<int>(static_cast<int64_t>(rangeCount) * index / threads);
+    int end = static_cast<int>(static_cast<int64_t>(rangeCount) * (index + 1) / threads);
+    if (begin < end) rangeFunction(rangeContext, begin, end);
+}
+
+bool ThreadPool::popTask(int index, Task& task) {
+    // Own deque first (front = most recently pushed, still cache-warm)
+    {
+        WorkerQueue& own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.front());
+            own.tasks.pop_front();
+            return true;
+        }
+    }
+
+    // Steal the oldest task from another worker
+    int count = static_cast<int>(queues.size());
+    for (int offset = 1; offset < count; offset++) {
+        WorkerQueue& victim = *queues[(index + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(int index) {
+    currentPool = this;
+    currentWorker = index;
+    uint64_t rangesSeen = 0;
+
+    while (true) {
+        Task task;
+        if (popTask(index, task)) {
+            queuedTasks--;
+            task();
+
+            if (--pendingTasks == 0) {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                allDone.notify_all();
+            }
+            continue;
+        }
+
+        // Nothing to run or steal: sleep until new work arrives
+        std::unique_lock<std::mutex> lock(stateMutex);
+        workAvailable.wait(lock, [this, rangesSeen] {
+            return stopping || queuedTasks.load() > 0 || rangeGeneration != rangesSeen;
+        });
+
+        // The range fields stay fixed until every worker has finished
+        if (rangeGeneration != rangesSeen) {
+            rangesSeen = rangeGeneration;
+            lock.unlock();
+            runRange(index);
+            lock.lock();
+            if (--rangesLeft == 0) allDone.notify_all();
+            continue;
+        }
+        if (stopping && queuedTasks.load() == 0) {
+            return;
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#include "TranspositionTable.h"
+#include <cstring>
+
+TranspositionTable::TranspositionTable(int sizeLog2)
+    : slots(new Slot[size_t(1) << sizeLog2]), mask((size_t(1) << sizeLog2) - 1) {
+    clear();
+}
+
+bool TranspositionTable::probe(uint64_t key, double& value) const {
+    const Slot& slot = slots[key & mask];
+    uint64_t bits = slot.value.load(std::memory_order_relaxed);
+    uint64_t check = slot.check.load(std::memory_order_relaxed);
+    if ((check ^ bits) != key) return false;
+
+    std::memcpy(&value, &bits, sizeof(value));
+    return true;
+}
+
+void TranspositionTable::store(uint64_t key, double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    Slot& slot = slots[key & mask];
+    slot.value.store(bits, std::memory_order_relaxed);
+    slot.check.store(key ^ bits, std::memory_order_relaxed);
+}
+
+void TranspositionTable::clear() {
+    // An empty slot only matches key 0 (a 1 in 2^64 chance for a real position)
+    for (size_t i = 0; i <= mask; i++) {
+        slots[i].check.store(0, std::memory_order_relaxed);
+        slots[i].value.store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,100 @@
+#include "VecEnv.h"
+#include <algorithm>
+#include <cstring>
+
+// Independent seed for each (game, episode) pair
+static uint64_t episodeSeed(uint64_t seed, uint64_t env, uint64_t episode) {
+    uint64_t z = seed + (env + 1) * 0x9E3779B97F4A7C15ull + episode * 0xD1B54A32D192ED03ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+VecEnv::VecEnv(const VecEnvConfig& config) : config(config) {
+    int envs = std::max(1, config.envs);
+    cores.assign(envs, GameCore(0, config.mode));
+    episodes.assign(envs, 0);
+    if (config.threads != 1) {
+        pool = std::make_unique<ThreadPool>(config.threads);
+    }
+
+    observations.assign(static_cast<size_t>(envs) * OBSERVATION_SIZE, 0);
+    pieces.assign(static_cast<size_t>(envs) * PIECE_SLOTS, -1);
+    scores.assign(envs, 0);
+    rewards.assign(envs, 0.0f);
+    dones.assign(envs, 0);
+    finalScores.assign(envs, 0);
+
+    reset();
+}
+
+void VecEnv::reset() {
+    for (int env = 0; env < size(); env++) {
+        resetEnv(env);
+        rewards[env] = 0.0f;
+        dones[env] = 0;
+        observe(env);
+    }
+}
+
+void VecEnv::resetEnv(int env) {
+    cores[env].reset(episodeSeed(config.seed, static_cast<uint64_t>(env), episodes[env]++));
+}
+
+void VecEnv::step(const uint8_t* actions) {
+    if (pool) {
+        pool->parallelFor(size(), [this, actions](int begin, int end) {
+            stepRange(actions, begin, end);
+        });
+    } else {
+        stepRange(actions, 0, size());
+    }
+}
+
+void VecEnv::stepRange(const uint8_t* actions, int begin, int end) {
+    for (int env = begin; env < end; env++) {
+        GameCore& core = cores[env];
+        int before = core.getScore();
+
+        if (actions[env] < NOOP) {
+            core.applyAction(static_cast<InputAction>(actions[env]));
+        }
+        core.tick(config.ticksPerStep);
+
+        rewards[env] = static_cast<float>(core.getScore() - before);
+        dones[env] = core.isGameOver() ? 1 : 0;
+        if (dones[env]) {
+            finalScores[env] = core.getScore();
+            resetEnv(env);
+        }
+        observe(env);
+    }
+}
+
+void VecEnv::observe(int env) {
+    const GameCore& core = cores[env];
+    uint8_t* board = &observations[static_cast<size_t>(env) * OBSERVATION_SIZE];
+    uint8_t* piece = board + PLANE_SIZE;
+
+    for (int y = 0; y < Board::HEIGHT; y++) {
+        uint16_t row = core.getBoard().getRow(y);
+        for (int x = 0; x < Board::WIDTH; x++) {
+            board[y * Board::WIDTH + x] = (row >> x) & 1;
+        }
+    }
+
+    std::memset(piece, 0, PLANE_SIZE);
+    for (const auto& cell : core.getCurrentPiece().getOccupiedCells()) {
+        if (cell.first >= 0 && cell.first < Board::WIDTH && cell.second >= 0 && cell.second < Board::HEIGHT) {
+            piece[cell.second * Board::WIDTH + cell.first] = 1;
+        }
+    }
+
+    int8_t* slots = &pieces[static_cast<size_t>(env) * PIECE_SLOTS];
+    const Tetromino* held = core.getHoldPiece();
+    slots[0] = static_cast<int8_t>(core.getCurrentPiece().getType());
+    slots[1] = static_cast<int8_t>(core.getNextPiece().getType());
+    slots[2] = held ? static_cast<int8_t>(held->getType()) : -1;
+
+    scores[env] = core.getScore();
+}
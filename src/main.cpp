@@ -1,8 +1,29 @@
 #include "Game.h"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 
-int main() {
+int main(int argc, char* argv[]) {
     Game game;
+    InputConfig input;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--uncapped") == 0) {
+            // Simulation speed is fixed; only the render rate changes
+            game.setUncapped(true);
+        } else if (std::strcmp(argv[i], "--das") == 0 && i + 1 < argc) {
+            input.das = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--arr") == 0 && i + 1 < argc) {
+            input.arr = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--sdf") == 0 && i + 1 < argc) {
+            input.softDropFactor = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--lookahead") == 0 && i + 1 < argc) {
+            // Preview pieces the autoplay bot searches (0-2)
+            game.setBotLookahead(std::atoi(argv[++i]));
+        }
+    }
+
+    game.setInputConfig(input);
     game.run();
     return 0;
 }
@@ -0,0 +1,146 @@
+#include "Replay.h"
+#include "Simulator.h"
+#include "ThreadPool.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --games N        number of games to simulate (default 1000)\n"
+              << "  --threads N      worker threads, 0 = all cores (default 0)\n"
+              << "  --seed N         base seed for the piece sequences (default 1)\n"
+              << "  --policy NAME    move policy: random, greedy, heuristic (default random)\n"
+              << "  --lookahead N    preview pieces the heuristic policy searches, 0-2 (default 1)\n"
+              << "  --cache BITS     share a 2^BITS slot transposition table between games\n"
+              << "  --max-pieces N   per-game piece cap (default 10000)\n"
+              << "  --bag            use the 7-bag generator instead of uniform\n"
+              << "  --replay FILE    play a recorded replay headless (repeatable)\n"
+              << "  --seek TICK      with --replay, stop at this tick instead of the end\n";
+}
+
+// Play replays at full speed (in parallel) and print their final state
+static int runReplays(const std::vector<std::string>& files, int threads, long seekTick) {
+    struct Result {
+        bool loaded = false;
+        uint32_t tick = 0;
+        int score = 0, lines = 0, level = 0, pieces = 0;
+        bool gameOver = false;
+    };
+    std::vector<Result> results(files.size());
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        ThreadPool pool(threads);
+        for (size_t i = 0; i < files.size(); i++) {
+            pool.submit([&, i] {
+                Replay replay;
+                if (!replay.load(files[i])) return;
+
+                ReplayPlayer player(replay);
+                if (seekTick >= 0) {
+                    player.seek(static_cast<uint32_t>(seekTick));
+                } else {
+                    player.runToEnd();
+                }
+
+                const GameCore& core = player.getCore();
+                Result& result = results[i];
+                result.loaded = true;
+                result.tick = player.getTick();
+                result.score = core.getScore();
+                result.lines = core.getLines();
+                result.level = core.getLevel();
+                result.pieces = core.getPiecesPlaced();
+                result.gameOver = core.isGameOver();
+            });
+        }
+        pool.wait();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    int failures = 0;
+    uint64_t ticks = 0;
+    for (size_t i = 0; i < files.size(); i++) {
+        const Result& result = results[i];
+        if (!result.loaded) {
+            std::cerr << files[i] << ": not a valid replay" << std::endl;
+            failures++;
+            continue;
+        }
+        ticks += result.tick;
+        std::cout << files[i] << ": tick " << result.tick
+                  << " score " << result.score << " lines " << result.lines
+                  << " level " << result.level << " pieces " << result.pieces
+                  << (result.gameOver ? " (game over)" : "") << "\n";
+    }
+    std::cout << std::fixed << std::setprecision(2)
+              << "replays:          " << files.size() - failures << "\n"
+              << "seconds:          " << seconds << "\n"
+              << "ticks/sec:        " << (seconds > 0.0 ? ticks / seconds : 0.0) << std::endl;
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    SimConfig config;
+    std::vector<std::string> replays;
+    long seekTick = -1;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(arg, "--games") == 0 && hasValue) {
+            config.games = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--threads") == 0 && hasValue) {
+            config.threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            config.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--policy") == 0 && hasValue) {
+            config.policy = argv[++i];
+        } else if (std::strcmp(arg, "--lookahead") == 0 && hasValue) {
+            config.lookahead = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--cache") == 0 && hasValue) {
+            config.cacheBits = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--max-pieces") == 0 && hasValue) {
+            config.maxPieces = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--bag") == 0) {
+            config.mode = GeneratorMode::SEVEN_BAG;
+        } else if (std::strcmp(arg, "--replay") == 0 && hasValue) {
+            replays.push_back(argv[++i]);
+        } else if (std::strcmp(arg, "--seek") == 0 && hasValue) {
+            seekTick = std::atol(argv[++i]);
+        } else {
+            printUsage(argv[0]);
+            return std::strcmp(arg, "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    if (!replays.empty()) {
+        return runReplays(replays, config.threads, seekTick);
+    }
+
+    if (!MovePolicy::create(config.policy, 0)) {
+        std::cerr << "Unknown policy: " << config.policy << std::endl;
+        return 1;
+    }
+
+    Simulator simulator(config);
+    SimStats stats = simulator.run();
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "games:            " << stats.games << "\n"
+              << "pieces:           " << stats.pieces << "\n"
+              << "lines:            " << stats.lines << "\n"
+              << "average score:    " << (stats.games ? double(stats.totalScore) / stats.games : 0.0) << "\n"
+              << "best score:       " << stats.bestScore << "\n"
+              << "threads:          " << stats.threads << "\n"
+              << "seconds:          " << stats.seconds << "\n"
+              << "pieces/sec:       " << stats.piecesPerSecond() << "\n"
+              << "pieces/sec/core:  " << stats.piecesPerSecondPerCore() << std::endl;
+    return 0;
+}